@@ -19,3 +19,6 @@ set(F_KERNEL_VIRTUAL_ADDRESS                0xFFFF800000000000)
 set(F_KERNEL_PHYSICAL_MAPPING_ADDRESS       0xFFFFA00000000000)
 set(F_KERNEL_STACK_SIZE_KB                  16)
 set(F_KERNEL_INITIAL_HEAP_SIZE_KB           4096)
+set(F_KERNEL_HEAP_GROW_SIZE_KB              256)
+set(F_KERNEL_HEAP_MAX_SIZE_KB               262144)
+set(F_KERNEL_HEAP_PROFILER_SAMPLE_INTERVAL_KB 512)     # 0 disables the heap profiler
@@ -317,7 +317,8 @@ namespace FunnyOS::Bootloader64 {
             GetMemoryMap().Append(Stdlib::Move(highRegion));
         }
 
-        Stdlib::Vector<Misc::MemoryAllocator::MemoryFragment> memoryFragments{4};
+        // There are only a few usable regions, so the fragment list normally stays on the stack
+        Stdlib::InlineVector<Misc::MemoryAllocator::MemoryFragment, 8> memoryFragments;
 
         for (auto& region : GetMemoryMap()) {
             if (region.Type != Bootparams::MemoryRegionType::AvailableMemory) {
@@ -3,8 +3,11 @@
 
 #include <FunnyOS/Bootparams/Parameters.hpp>
 #include <FunnyOS/Hardware/GDT.hpp>
-#include <FunnyOS/Misc/MemoryAllocator/StaticMemoryAllocator.hpp>
 #include "GFX/ScreenManager.hpp"
+#include "MM/HeapCache.hpp"
+#include "MM/HeapProfiler.hpp"
+#include "MM/KernelHeap.hpp"
+#include "MM/LargeAllocator.hpp"
 #include "MM/PhysicalMemoryManager.hpp"
 #include "MM/VirtualMemoryManager.hpp"
 #include "Interrupt.hpp"
@@ -94,7 +97,29 @@ namespace FunnyOS::Kernel {
          *
          * @return kernel heap allocator.
          */
-        [[nodiscard]] Misc::MemoryAllocator::StaticMemoryAllocator& GetKernelAllocator();
+        [[nodiscard]] MM::KernelHeap& GetKernelAllocator();
+
+        /**
+         * Returns the small object cache of the CPU this code runs on. It must be used only by that CPU.
+         * Only the bootstrap processor is running for now, so this is always its cache.
+         *
+         * @return heap cache of the current CPU
+         */
+        [[nodiscard]] MM::HeapCache& GetCurrentCpuHeapCache();
+
+        /**
+         * Returns the sampling profiler of the kernel heap.
+         *
+         * @return kernel heap profiler
+         */
+        [[nodiscard]] MM::HeapProfiler& GetHeapProfiler();
+
+        /**
+         * Returns the allocator that serves big allocations directly from the physical memory manager.
+         *
+         * @return large allocations allocator
+         */
+        [[nodiscard]] MM::LargeAllocator& GetLargeAllocator();
 
         /**
          * Returns the log manager used by the kernel.
@@ -119,7 +144,10 @@ namespace FunnyOS::Kernel {
         Bootparams::BootDriveInfo m_bootDriveInfo{};
         MM::PhysicalMemoryManager m_physicalMemoryManager{};
         MM::VirtualMemoryManager m_virtualMemoryManager{m_physicalMemoryManager};
-        Misc::MemoryAllocator::StaticMemoryAllocator m_kernelAllocator{};
+        MM::KernelHeap m_kernelAllocator{};
+        MM::HeapCache m_bootstrapCpuHeapCache{m_kernelAllocator};
+        MM::HeapProfiler m_heapProfiler{MM::HEAP_PROFILER_SAMPLE_INTERVAL};
+        MM::LargeAllocator m_largeAllocator{m_physicalMemoryManager};
         LogManager m_logManager{};
         GFX::ScreenManager m_screenManager{};
     };
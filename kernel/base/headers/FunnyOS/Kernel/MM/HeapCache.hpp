@@ -0,0 +1,129 @@
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPCACHE_HPP
+#define FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPCACHE_HPP
+
+#include <FunnyOS/Stdlib/IntegerTypes.hpp>
+#include "KernelHeap.hpp"
+
+namespace FunnyOS::Kernel::MM {
+
+    /**
+     * Per-CPU cache of small objects, placed in front of the KernelHeap.
+     *
+     * Every size class has its own list of free objects. Allocating and freeing small objects only pushes and pops
+     * those lists, which are only ever accessed by their own CPU and therefore need no locks. Objects are taken from
+     * the heap and given back to it in batches of BATCH_SIZE objects, so the heap is only touched once every few
+     * operations.
+     *
+     * The cached objects are ordinary heap blocks. The size class of a freed object is derived from the size of its
+     * heap block, so the objects carry no additional header and any heap block can be freed through the cache. The
+     * blocks are taken a little bigger than their size class, so that consecutive blocks stay aligned to
+     * OBJECT_ALIGNMENT.
+     */
+    class HeapCache {
+       public:
+        NON_COPYABLE(HeapCache);
+        NON_MOVEABLE(HeapCache);
+
+        /**
+         * Difference between the sizes of two consecutive size classes.
+         */
+        static constexpr const size_t SIZE_CLASS_GRANULARITY = 16;
+
+        /**
+         * Amount of size classes.
+         */
+        static constexpr const size_t SIZE_CLASS_COUNT = 16;
+
+        /**
+         * Size of the biggest objects that are cached.
+         */
+        static constexpr const size_t MAXIMUM_OBJECT_SIZE = SIZE_CLASS_COUNT * SIZE_CLASS_GRANULARITY;
+
+        /**
+         * Alignment of every cached object, allocations with a bigger alignment go directly to the heap.
+         */
+        static constexpr const size_t OBJECT_ALIGNMENT = 16;
+
+        /**
+         * Amount of objects moved between the cache and the heap at once.
+         */
+        static constexpr const size_t BATCH_SIZE = 16;
+
+        /**
+         * Constructs a new cache in front of the given heap.
+         *
+         * @param heap heap to take the objects from
+         */
+        explicit HeapCache(KernelHeap& heap) noexcept;
+
+        /**
+         * Allocates a chunk of memory, see IMemoryAllocator::Allocate.
+         *
+         * @param[in] size size of the memory
+         * @param[in] alignment memory alignment
+         * @return the newly allocated chunk or nullptr if not enough memory.
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment) noexcept;
+
+        /**
+         * Frees a chunk of memory previously allocated via Allocate or Reallocate of this cache or the heap.
+         *
+         * @param[in,out] ptr memory to free, may be nullptr
+         */
+        void Free(void* ptr) noexcept;
+
+        /**
+         * Reallocates a chunk of memory, see IMemoryAllocator::Reallocate.
+         *
+         * @param[in,out] ptr memory, is is freed when return value of this function is not nullptr
+         * @param[in] size size of the memory block.
+         * @param[in] alignment memory alignment
+         * @return the newly allocated chunk or nullptr if not enough memory.
+         */
+        [[nodiscard]] void* Reallocate(void* ptr, size_t size, size_t alignment) noexcept;
+
+        /**
+         * Gives all cached objects back to the heap.
+         */
+        void Flush() noexcept;
+
+        /**
+         * Gets the amount of free objects currently held by this cache.
+         *
+         * @return amount of cached objects
+         */
+        [[nodiscard]] size_t GetCachedObjectCount() const noexcept;
+
+       private:
+        /**
+         * List of free objects of a single size class. Every free object holds a pointer to the next one.
+         */
+        struct FreeList {
+            void* Head;
+            size_t Count;
+        };
+
+        /**
+         * Takes a batch of objects of the given size class from the heap.
+         *
+         * @param sizeClass size class to refill
+         * @return whether or not at least one object was taken
+         */
+        bool Refill(size_t sizeClass) noexcept;
+
+        /**
+         * Gives the given amount of objects of the given size class back to the heap.
+         *
+         * @param sizeClass size class to release the objects from
+         * @param count maximum amount of objects to release
+         */
+        void Release(size_t sizeClass, size_t count) noexcept;
+
+       private:
+        KernelHeap& m_heap;
+        FreeList m_freeLists[SIZE_CLASS_COUNT];
+    };
+
+}  // namespace FunnyOS::Kernel::MM
+
+#endif  // FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPCACHE_HPP
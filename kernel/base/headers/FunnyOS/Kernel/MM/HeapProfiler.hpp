@@ -0,0 +1,171 @@
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_HPP
+#define FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_HPP
+
+#include <FunnyOS/Kernel/Config.hpp>
+#include <FunnyOS/Stdlib/IntegerTypes.hpp>
+#include <FunnyOS/Stdlib/Logging.hpp>
+#include <FunnyOS/Stdlib/System.hpp>
+
+namespace FunnyOS::Kernel::MM {
+
+    /**
+     * Average amount of allocated bytes between two samples of the heap profiler, 0 if the profiler is disabled.
+     */
+#ifdef F_KERNEL_HEAP_PROFILER_SAMPLE_INTERVAL_KB
+    constexpr const size_t HEAP_PROFILER_SAMPLE_INTERVAL = F_KERNEL_HEAP_PROFILER_SAMPLE_INTERVAL_KB * 1024;
+#else
+    constexpr const size_t HEAP_PROFILER_SAMPLE_INTERVAL = 0;
+#endif
+
+    /**
+     * Sampling profiler of the kernel heap.
+     *
+     * Instead of recording every allocation, the profiler records one allocation in every SampleInterval allocated
+     * bytes on average. The distance between two samples is randomized, so periodic allocation patterns are not
+     * missed. A sample captures the call stack of the allocation by walking the frame pointers and is aggregated in a
+     * fixed-size table of call sites, so the profiler never allocates itself. Every sample is weighted by the amount
+     * of bytes it represents, which makes the table an estimate of how many bytes every call site allocated.
+     *
+     * Allocations that are not sampled cost only a single subtraction.
+     */
+    class HeapProfiler {
+       public:
+        NON_COPYABLE(HeapProfiler);
+        NON_MOVEABLE(HeapProfiler);
+
+        /**
+         * Amount of return addresses captured for every sample.
+         */
+        static constexpr const size_t STACK_DEPTH = 6;
+
+        /**
+         * Amount of frames skipped at the top of every captured stack, these are the allocation functions themselves
+         * (_Platform and Stdlib::Memory). Memory.cpp is built with frame pointers and without sibling calls, so
+         * Stdlib::Memory always has exactly one frame of its own.
+         */
+        static constexpr const size_t SKIPPED_FRAMES = 2;
+
+        /**
+         * Maximum amount of distinct call sites, samples of other call sites are dropped.
+         */
+        static constexpr const size_t CALL_SITE_COUNT = 128;
+
+        /**
+         * Constructs a new profiler.
+         *
+         * @param sampleInterval average amount of allocated bytes between two samples, 0 disables the profiler
+         */
+        explicit HeapProfiler(size_t sampleInterval) noexcept;
+
+        /**
+         * Sets the stack that the frame pointer walks are limited to. No stack is captured until this is called.
+         *
+         * @param stackBottom lowest address of the stack
+         * @param stackTop highest address of the stack + 1
+         */
+        void SetStackBounds(uintptr_t stackBottom, uintptr_t stackTop) noexcept;
+
+        /**
+         * Changes the sampling interval.
+         *
+         * @param sampleInterval average amount of allocated bytes between two samples, 0 disables the profiler
+         */
+        void SetSampleInterval(size_t sampleInterval) noexcept;
+
+        /**
+         * Must be called on every allocation, samples it if needed.
+         *
+         * @param size size of the allocation
+         */
+        inline void RecordAllocation(size_t size) noexcept;
+
+        /**
+         * Logs the call sites that allocated most bytes.
+         *
+         * @param logger logger to log the call sites to
+         * @param maximumCallSites maximum amount of call sites to log
+         */
+        void Dump(Stdlib::Logger& logger, size_t maximumCallSites) noexcept;
+
+        /**
+         * Removes all samples.
+         */
+        void Reset() noexcept;
+
+        /**
+         * Gets the amount of samples taken since the last reset.
+         *
+         * @return the amount of samples
+         */
+        [[nodiscard]] size_t GetSampleCount() const noexcept;
+
+        /**
+         * Gets the amount of samples that were dropped because the table of call sites was full.
+         *
+         * @return the amount of dropped samples
+         */
+        [[nodiscard]] size_t GetDroppedSampleCount() const noexcept;
+
+       private:
+        /**
+         * Aggregated samples of a single call stack.
+         */
+        struct CallSite {
+            /**
+             * Return addresses of the call stack, the innermost first. Unused entries are 0.
+             */
+            uintptr_t Stack[STACK_DEPTH];
+
+            /**
+             * Amount of samples taken at this call site, 0 if this entry is unused.
+             */
+            size_t Samples;
+
+            /**
+             * Estimated amount of bytes allocated at this call site.
+             */
+            size_t Bytes;
+        };
+
+        /**
+         * Captures the call stack and records the sample.
+         *
+         * @param size size of the sampled allocation
+         */
+        F_NEVER_INLINE void TakeSample(size_t size) noexcept;
+
+        /**
+         * Captures the return addresses of the current call stack.
+         *
+         * @param stack array of STACK_DEPTH addresses to fill
+         */
+        F_NEVER_INLINE void CaptureStack(uintptr_t* stack) const noexcept;
+
+        /**
+         * Finds the entry of the given call stack, or an unused entry for it.
+         *
+         * @return the entry or nullptr if the table is full
+         */
+        [[nodiscard]] CallSite* FindCallSite(const uintptr_t* stack) noexcept;
+
+        /**
+         * Picks the amount of bytes to be allocated before the next sample.
+         */
+        [[nodiscard]] size_t NextSampleDistance() noexcept;
+
+       private:
+        size_t m_sampleInterval;
+        size_t m_bytesUntilSample;
+        uint64_t m_randomState;
+        uintptr_t m_stackBottom;
+        uintptr_t m_stackTop;
+        size_t m_sampleCount;
+        size_t m_droppedSampleCount;
+        bool m_sampling;
+        CallSite m_callSites[CALL_SITE_COUNT];
+    };
+
+}  // namespace FunnyOS::Kernel::MM
+
+#include "HeapProfiler.tcc"
+#endif  // FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_HPP
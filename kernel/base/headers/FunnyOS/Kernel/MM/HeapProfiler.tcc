@@ -0,0 +1,19 @@
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_HPP
+#error "Include HeapProfiler.hpp instead"
+#endif
+
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_TCC
+#define FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_TCC
+
+namespace FunnyOS::Kernel::MM {
+    inline void HeapProfiler::RecordAllocation(size_t size) noexcept {
+        if (size < m_bytesUntilSample) {
+            m_bytesUntilSample -= size;
+            return;
+        }
+
+        TakeSample(size);
+    }
+}  // namespace FunnyOS::Kernel::MM
+
+#endif  // FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_HEAPPROFILER_TCC
@@ -0,0 +1,102 @@
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_KERNELHEAP_HPP
+#define FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_KERNELHEAP_HPP
+
+#include <FunnyOS/Kernel/Config.hpp>
+#include <FunnyOS/Misc/MemoryAllocator/StaticMemoryAllocator.hpp>
+#include "PhysicalMemoryManager.hpp"
+#include "VirtualMemoryManager.hpp"
+
+namespace FunnyOS::Kernel::MM {
+    using Misc::MemoryAllocator::memoryaddress_t;
+
+    /**
+     * Size of the memory mapped at once when the kernel heap grows.
+     */
+    constexpr const size_t KERNEL_HEAP_GROW_SIZE = F_KERNEL_HEAP_GROW_SIZE_KB * 1024;
+
+    /**
+     * Maximum size of the kernel heap, including the initial heap.
+     */
+    constexpr const size_t KERNEL_HEAP_MAX_SIZE = F_KERNEL_HEAP_MAX_SIZE_KB * 1024;
+
+    /**
+     * Kernel heap allocator.
+     *
+     * The heap starts with the initial heap reserved in the kernel image. Once growth is enabled, the heap maps new
+     * physical pages just after its end whenever an allocation does not fit, in chunks of KERNEL_HEAP_GROW_SIZE bytes,
+     * up to KERNEL_HEAP_MAX_SIZE bytes. When the top of the heap is freed the chunks that are no longer used are
+     * unmapped and given back to the physical memory manager, one chunk is always kept to avoid remapping it over and
+     * over again. The initial heap is never given back.
+     */
+    class KernelHeap : public Misc::MemoryAllocator::IMemoryAllocator {
+       public:
+        /**
+         * Initializes the heap with its initial memory, the memory must be already mapped.
+         *
+         * @param memoryStart[in] the first address of the initial heap, must be aligned to PAGE_SIZE
+         * @param memoryEnd[in] last address of the initial heap + 1, must be aligned to PAGE_SIZE
+         */
+        void Initialize(memoryaddress_t memoryStart, memoryaddress_t memoryEnd) noexcept;
+
+        /**
+         * Allows the heap to grow above its initial memory. Must be called after the page tables of the kernel are
+         * initialized.
+         *
+         * @param vmm virtual memory manager used to map the new memory
+         * @param pmm physical memory manager used to allocate the new memory
+         */
+        void EnableGrowth(VirtualMemoryManager& vmm, PhysicalMemoryManager& pmm) noexcept;
+
+        void* Allocate(size_t size, size_t alignment) noexcept override;
+
+        void Free(void* ptr) noexcept override;
+
+        void* Reallocate(void* ptr, size_t size, size_t alignment) noexcept override;
+
+        size_t GetTotalFreeMemory() const noexcept override;
+
+        size_t GetAllocatedMemory() const noexcept override;
+
+        size_t GetTotalAvailableMemory() const noexcept override;
+
+        /**
+         * Gets a size of a memory block that was allocated using Allocate before.
+         *
+         * @param ptr ptr returned by Allocate
+         */
+        size_t GetMemoryBlockSize(void* ptr);
+
+        /**
+         * Returns the allocator that manages the memory of this heap.
+         *
+         * @return the underlying allocator
+         */
+        [[nodiscard]] const Misc::MemoryAllocator::StaticMemoryAllocator& GetAllocator() const noexcept;
+
+       private:
+        /**
+         * Maps new memory at the end of the heap so an allocation of the given size and alignment can succeed.
+         *
+         * @param size size of the allocation that failed
+         * @param alignment alignment of the allocation that failed
+         * @return whether or not any new memory was mapped
+         */
+        bool Grow(size_t size, size_t alignment) noexcept;
+
+        /**
+         * Unmaps chunks at the end of the heap that are no longer used.
+         */
+        void ShrinkIfPossible() noexcept;
+
+       private:
+        Misc::MemoryAllocator::StaticMemoryAllocator m_allocator{};
+        VirtualMemoryManager* m_virtualMemoryManager   = nullptr;
+        PhysicalMemoryManager* m_physicalMemoryManager = nullptr;
+        memoryaddress_t m_initialMemoryEnd             = 0;
+        memoryaddress_t m_maximumMemoryEnd             = 0;
+        bool m_resizing                                = false;
+    };
+
+}  // namespace FunnyOS::Kernel::MM
+
+#endif  // FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_KERNELHEAP_HPP
@@ -0,0 +1,131 @@
+#ifndef FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_LARGEALLOCATOR_HPP
+#define FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_LARGEALLOCATOR_HPP
+
+#include <FunnyOS/Stdlib/IntegerTypes.hpp>
+#include <FunnyOS/Stdlib/System.hpp>
+#include "PhysicalMemoryManager.hpp"
+
+namespace FunnyOS::Kernel::MM {
+
+    /**
+     * Allocator for big allocations, that bypasses the kernel heap.
+     *
+     * Every allocation is a run of contiguous physical pages taken directly from the PhysicalMemoryManager and accessed
+     * through the mapping of the whole physical memory, so no page tables are modified. The pages are given back to
+     * the PhysicalMemoryManager as soon as the allocation is freed, so big buffers never fragment the heap.
+     *
+     * The size of every allocation is kept in a fixed-size side table, keyed by the address of the allocation. The
+     * allocator never uses the heap itself.
+     */
+    class LargeAllocator {
+       public:
+        NON_COPYABLE(LargeAllocator);
+        NON_MOVEABLE(LargeAllocator);
+
+        /**
+         * Minimum size of allocations served by this allocator.
+         */
+        static constexpr const size_t LARGE_ALLOCATION_THRESHOLD = 64 * 1024;
+
+        /**
+         * Maximum amount of allocations that can exist at the same time.
+         */
+        static constexpr const size_t MAXIMUM_ALLOCATIONS = 1024;
+
+        /**
+         * Constructs a new, disabled allocator.
+         *
+         * @param pmm physical memory manager to take the pages from
+         */
+        explicit LargeAllocator(PhysicalMemoryManager& pmm) noexcept;
+
+        /**
+         * Enables the allocator. Must be called after the physical memory manager is initialized and the whole
+         * physical memory is mapped.
+         */
+        void Enable() noexcept;
+
+        /**
+         * Checks whether an allocation of the given size should be served by this allocator.
+         *
+         * @param size size of the allocation
+         * @return whether or not the allocator is enabled and the allocation is big enough
+         */
+        [[nodiscard]] bool IsLargeAllocation(size_t size) const noexcept;
+
+        /**
+         * Allocates a run of pages that can hold [size] bytes.
+         *
+         * @param[in] size size of the memory
+         * @param[in] alignment memory alignment, at most PAGE_SIZE
+         * @return the newly allocated memory or nullptr if the allocator is disabled, the alignment is too big, the
+         * side table is full or there is not enough contiguous physical memory.
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment) noexcept;
+
+        /**
+         * Frees memory allocated by this allocator, its pages are given back to the physical memory manager.
+         *
+         * @param[in] ptr memory allocated by this allocator
+         */
+        void Free(void* ptr) noexcept;
+
+        /**
+         * Checks whether the given memory was allocated by this allocator.
+         *
+         * @param ptr pointer to check
+         * @return whether or not the memory was allocated by this allocator
+         */
+        [[nodiscard]] bool Owns(const void* ptr) const noexcept;
+
+        /**
+         * Gets the usable size of an allocation, that is the size of its page run.
+         *
+         * @param ptr memory allocated by this allocator
+         * @return the usable size of the memory
+         */
+        [[nodiscard]] size_t GetAllocationSize(const void* ptr) const noexcept;
+
+        /**
+         * Gets the amount of allocations that currently exist.
+         *
+         * @return the amount of allocations
+         */
+        [[nodiscard]] size_t GetAllocationCount() const noexcept;
+
+       private:
+        /**
+         * Entry of the side table.
+         */
+        struct Allocation {
+            /**
+             * Address of the allocated memory, 0 if the entry is unused.
+             */
+            uintptr_t Address;
+
+            /**
+             * Amount of pages in the run.
+             */
+            size_t Pages;
+        };
+
+        /**
+         * Finds the side table entry of the given address, or the unused entry where it should be inserted.
+         */
+        [[nodiscard]] size_t FindEntry(uintptr_t address) const noexcept;
+
+        /**
+         * Removes an entry from the side table, moving the following entries of its probe sequence back.
+         */
+        void RemoveEntry(size_t index) noexcept;
+
+       private:
+        PhysicalMemoryManager& m_physicalMemoryManager;
+        bool m_enabled;
+        size_t m_allocationCount;
+        Allocation m_allocations[MAXIMUM_ALLOCATIONS];
+    };
+
+}  // namespace FunnyOS::Kernel::MM
+
+#endif  // FUNNYOS_KERNEL_BASE_HEADERS_FUNNYOS_KERNEL_MM_LARGEALLOCATOR_HPP
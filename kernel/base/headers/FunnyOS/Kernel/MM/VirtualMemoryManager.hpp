@@ -80,6 +80,26 @@ namespace FunnyOS::Kernel {
              */
             void Map1GbPage(physicaladdress_t physicalAddress, uintptr_t virtualAddress, PageAttributes attributes);
 
+            /**
+             * Removes a single 4 KB page mapping. The page table that held the mapping is not freed.
+             *
+             * @param virtualAddress virtual address to be unmapped. Must be aligned to 4 KB
+             *
+             * @return physical address the page was mapped to or [NULL_ADDRESS] if the page was not mapped
+             */
+            physicaladdress_t Unmap4KbPage(uintptr_t virtualAddress);
+
+            /**
+             * Scans the page structures for page tables that map 512 contiguous, equally-attributed 4 KB pages backed
+             * by a physically contiguous, 2 MB aligned memory and collapses each of them into a single 2 MB page.
+             *
+             * The page tables of the collapsed entries are returned to the physical memory manager. Regions mapped
+             * with 1 GB pages (or emulated 1 GB pages) are never touched.
+             *
+             * @return amount of page tables that were promoted to 2 MB pages
+             */
+            size_t PromoteHugePages();
+
             /**
              * Checks whether or not the NX (no-execute) bit is supported by this CPU.
              *
@@ -125,6 +145,16 @@ namespace FunnyOS::Kernel {
              */
             physicaladdress_t AllocatePage();
 
+            /**
+             * Tries to collapse a page table into a single 2 MB page.
+             *
+             * @param directoryEntry pointer to the page directory entry pointing to the page table
+             * @param virtualAddress virtual address mapped by the page directory entry
+             *
+             * @return whether or not the page table was promoted
+             */
+            bool TryPromotePageTable(uint64_t* directoryEntry, uintptr_t virtualAddress);
+
             /**
              * Gets a pointer to a paging structure (i.e. to a page table or a page directory) by traversing the
              * structure recursively and allocating all the required entry.
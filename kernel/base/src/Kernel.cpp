@@ -12,6 +12,7 @@
 
 extern void* KERNEL_HEAP;
 extern void* KERNEL_HEAP_TOP;
+extern void* KERNEL_STACK_TOP;
 
 namespace FunnyOS::Kernel {
     Kernel64& Kernel64::Get() {
@@ -54,6 +55,9 @@ namespace FunnyOS::Kernel {
         m_kernelAllocator.Initialize(
             reinterpret_cast<memoryaddress_t>(&KERNEL_HEAP), reinterpret_cast<memoryaddress_t>(&KERNEL_HEAP_TOP));
 
+        const auto stackTop = reinterpret_cast<uintptr_t>(&KERNEL_STACK_TOP);
+        m_heapProfiler.SetStackBounds(stackTop - F_KERNEL_STACK_SIZE_KB * 1024, stackTop);
+
         // Load kernel GDT
         // Null selector
         m_kernelGdt[0] = 0;
@@ -129,8 +133,12 @@ namespace FunnyOS::Kernel {
         m_virtualMemoryManager.InitializePageTables();
         m_physicalMemoryManager.ReclaimMemory(Bootparams::MemoryRegionType::PageTableReclaimable);
         m_physicalMemoryManager.ReclaimMemory(Bootparams::MemoryRegionType::LongMemReclaimable);
+        m_virtualMemoryManager.PromoteHugePages();
+        m_kernelAllocator.EnableGrowth(m_virtualMemoryManager, m_physicalMemoryManager);
+        m_largeAllocator.Enable();
 
         FK_LOG_OK("Kernel initialized.");
+        m_heapProfiler.Dump(m_logManager.GetLogger(), 10);
 
         FK_PANIC("kekw");
 
@@ -173,10 +181,22 @@ namespace FunnyOS::Kernel {
         return m_virtualMemoryManager;
     }
 
-    Misc::MemoryAllocator::StaticMemoryAllocator& Kernel64::GetKernelAllocator() {
+    MM::KernelHeap& Kernel64::GetKernelAllocator() {
         return m_kernelAllocator;
     }
 
+    MM::HeapCache& Kernel64::GetCurrentCpuHeapCache() {
+        return m_bootstrapCpuHeapCache;
+    }
+
+    MM::HeapProfiler& Kernel64::GetHeapProfiler() {
+        return m_heapProfiler;
+    }
+
+    MM::LargeAllocator& Kernel64::GetLargeAllocator() {
+        return m_largeAllocator;
+    }
+
     LogManager& Kernel64::GetLogManager() {
         return m_logManager;
     }
@@ -0,0 +1,140 @@
+#include <FunnyOS/Kernel/MM/HeapCache.hpp>
+
+namespace FunnyOS::Kernel::MM {
+    namespace {
+        using Misc::MemoryAllocator::MemoryMetaBlock;
+
+        /**
+         * Bytes added to every object taken from the heap, so that the heap block header and the object together are a
+         * multiple of OBJECT_ALIGNMENT. Consecutive objects then stay aligned without the heap having to insert a
+         * padding block in front of every other one.
+         */
+        constexpr const size_t OBJECT_PADDING =
+            (HeapCache::OBJECT_ALIGNMENT - sizeof(MemoryMetaBlock) % HeapCache::OBJECT_ALIGNMENT) %
+            HeapCache::OBJECT_ALIGNMENT;
+
+        /**
+         * Gets the smallest size class whose objects can hold [size] bytes.
+         */
+        inline size_t GetSizeClassFor(size_t size) {
+            return size == 0 ? 0 : (size - 1) / HeapCache::SIZE_CLASS_GRANULARITY;
+        }
+
+        /**
+         * Gets the size of objects in the given size class.
+         */
+        inline size_t GetSizeClassSize(size_t sizeClass) {
+            return (sizeClass + 1) * HeapCache::SIZE_CLASS_GRANULARITY;
+        }
+
+        /**
+         * Gets the pointer to the next free object, stored in the free object itself.
+         */
+        inline void*& NextFreeObject(void* object) {
+            return *static_cast<void**>(object);
+        }
+    }  // namespace
+
+    HeapCache::HeapCache(KernelHeap& heap) noexcept : m_heap(heap), m_freeLists() {}
+
+    void* HeapCache::Allocate(size_t size, size_t alignment) noexcept {
+        if (size > MAXIMUM_OBJECT_SIZE || alignment > OBJECT_ALIGNMENT) {
+            return m_heap.Allocate(size, alignment);
+        }
+
+        const size_t sizeClass = GetSizeClassFor(size);
+        FreeList& list         = m_freeLists[sizeClass];
+
+        if (list.Head == nullptr && !Refill(sizeClass)) {
+            return nullptr;
+        }
+
+        void* object = list.Head;
+        list.Head    = NextFreeObject(object);
+        list.Count--;
+
+        return object;
+    }
+
+    void HeapCache::Free(void* ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        // Blocks allocated directly from the heap may be smaller than the smallest size class or not aligned
+        const size_t blockSize = m_heap.GetMemoryBlockSize(ptr);
+        if (blockSize < SIZE_CLASS_GRANULARITY || (reinterpret_cast<uintptr_t>(ptr) % OBJECT_ALIGNMENT) != 0) {
+            m_heap.Free(ptr);
+            return;
+        }
+
+        // The block is put to the biggest size class it can serve
+        const size_t sizeClass = blockSize / SIZE_CLASS_GRANULARITY - 1;
+        if (sizeClass >= SIZE_CLASS_COUNT) {
+            m_heap.Free(ptr);
+            return;
+        }
+
+        FreeList& list      = m_freeLists[sizeClass];
+        NextFreeObject(ptr) = list.Head;
+        list.Head           = ptr;
+        list.Count++;
+
+        if (list.Count >= BATCH_SIZE * 2) {
+            Release(sizeClass, BATCH_SIZE);
+        }
+    }
+
+    void* HeapCache::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
+        // Cached objects are heap blocks, so the heap can reallocate them in place
+        return m_heap.Reallocate(ptr, size, alignment);
+    }
+
+    void HeapCache::Flush() noexcept {
+        for (size_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; sizeClass++) {
+            Release(sizeClass, m_freeLists[sizeClass].Count);
+        }
+    }
+
+    size_t HeapCache::GetCachedObjectCount() const noexcept {
+        size_t count = 0;
+
+        for (const auto& list : m_freeLists) {
+            count += list.Count;
+        }
+
+        return count;
+    }
+
+    bool HeapCache::Refill(size_t sizeClass) noexcept {
+        // The padding is smaller than the granularity, so Free still puts the block back into this size class
+        const size_t objectSize = GetSizeClassSize(sizeClass) + OBJECT_PADDING;
+        FreeList& list          = m_freeLists[sizeClass];
+
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            void* object = m_heap.Allocate(objectSize, OBJECT_ALIGNMENT);
+            if (object == nullptr) {
+                break;
+            }
+
+            NextFreeObject(object) = list.Head;
+            list.Head              = object;
+            list.Count++;
+        }
+
+        return list.Head != nullptr;
+    }
+
+    void HeapCache::Release(size_t sizeClass, size_t count) noexcept {
+        FreeList& list = m_freeLists[sizeClass];
+
+        for (size_t i = 0; i < count && list.Head != nullptr; i++) {
+            void* object = list.Head;
+            list.Head    = NextFreeObject(object);
+            list.Count--;
+
+            m_heap.Free(object);
+        }
+    }
+
+}  // namespace FunnyOS::Kernel::MM
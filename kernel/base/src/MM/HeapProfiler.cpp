@@ -0,0 +1,202 @@
+#include <FunnyOS/Kernel/MM/HeapProfiler.hpp>
+
+#include <FunnyOS/Stdlib/Algorithm.hpp>
+#include <FunnyOS/Stdlib/Memory.hpp>
+#include <FunnyOS/Stdlib/String.hpp>
+
+namespace FunnyOS::Kernel::MM {
+    namespace {
+        /**
+         * Return addresses that point into the profiler itself (the return from CaptureStack to TakeSample), skipped
+         * in every captured stack.
+         */
+        constexpr const size_t PROFILER_FRAMES = 1;
+
+        constexpr const size_t NEVER_SAMPLE = ~static_cast<size_t>(0);
+
+        inline size_t HashStack(const uintptr_t* stack) {
+            uint64_t hash = 0xCBF29CE484222325;
+
+            for (size_t i = 0; i < HeapProfiler::STACK_DEPTH; i++) {
+                hash = (hash ^ stack[i]) * 0x100000001B3;
+            }
+
+            return static_cast<size_t>(hash ^ (hash >> 32));
+        }
+
+        inline bool IsSameStack(const uintptr_t* stack1, const uintptr_t* stack2) {
+            for (size_t i = 0; i < HeapProfiler::STACK_DEPTH; i++) {
+                if (stack1[i] != stack2[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }  // namespace
+
+    HeapProfiler::HeapProfiler(size_t sampleInterval) noexcept
+        : m_sampleInterval(0),
+          m_bytesUntilSample(NEVER_SAMPLE),
+          m_randomState(0x2545F4914F6CDD1D),
+          m_stackBottom(0),
+          m_stackTop(0),
+          m_sampleCount(0),
+          m_droppedSampleCount(0),
+          m_sampling(false),
+          m_callSites() {
+        SetSampleInterval(sampleInterval);
+    }
+
+    void HeapProfiler::SetStackBounds(uintptr_t stackBottom, uintptr_t stackTop) noexcept {
+        m_stackBottom = stackBottom;
+        m_stackTop    = stackTop;
+    }
+
+    void HeapProfiler::SetSampleInterval(size_t sampleInterval) noexcept {
+        m_sampleInterval   = sampleInterval;
+        m_bytesUntilSample = NextSampleDistance();
+    }
+
+    void HeapProfiler::Dump(Stdlib::Logger& logger, size_t maximumCallSites) noexcept {
+        // Logging may allocate, do not sample while the table is being read
+        m_sampling = true;
+
+        F_LOG_DEBUG_F(
+            logger, "Heap profile: %zu samples, one every %zu bytes, %zu dropped", m_sampleCount, m_sampleInterval,
+            m_droppedSampleCount);
+
+        bool dumped[CALL_SITE_COUNT] = {};
+        char stackText[STACK_DEPTH * 20 + 1];
+
+        for (size_t rank = 0; rank < maximumCallSites; rank++) {
+            // Selection of the next biggest call site, the table is small and this never allocates
+            size_t biggest = CALL_SITE_COUNT;
+            for (size_t i = 0; i < CALL_SITE_COUNT; i++) {
+                if (!dumped[i] && m_callSites[i].Samples != 0 &&
+                    (biggest == CALL_SITE_COUNT || m_callSites[i].Bytes > m_callSites[biggest].Bytes)) {
+                    biggest = i;
+                }
+            }
+
+            if (biggest == CALL_SITE_COUNT) {
+                break;
+            }
+
+            dumped[biggest]          = true;
+            const CallSite& callSite = m_callSites[biggest];
+            size_t stackTextLength   = 0;
+            stackText[0]             = 0;
+
+            for (size_t i = 0; i < STACK_DEPTH && callSite.Stack[i] != 0; i++) {
+                Stdlib::String::StringBuffer buffer{stackText + stackTextLength, sizeof(stackText) - stackTextLength};
+                Stdlib::String::Format(buffer, " 0x%016llx", static_cast<uint64_t>(callSite.Stack[i]));
+                stackTextLength += Stdlib::String::Length(buffer.Data);
+            }
+
+            F_LOG_DEBUG_F(
+                logger, "  #%zu ~%zu KB in %zu samples at%s", rank, callSite.Bytes / 1024, callSite.Samples, stackText);
+        }
+
+        m_sampling = false;
+    }
+
+    void HeapProfiler::Reset() noexcept {
+        Stdlib::Memory::ZeroMemory(m_callSites);
+        m_sampleCount        = 0;
+        m_droppedSampleCount = 0;
+    }
+
+    size_t HeapProfiler::GetSampleCount() const noexcept {
+        return m_sampleCount;
+    }
+
+    size_t HeapProfiler::GetDroppedSampleCount() const noexcept {
+        return m_droppedSampleCount;
+    }
+
+    void HeapProfiler::TakeSample(size_t size) noexcept {
+        m_bytesUntilSample = NextSampleDistance();
+
+        if (m_sampleInterval == 0 || m_sampling) {
+            return;
+        }
+
+        m_sampling = true;
+
+        uintptr_t stack[STACK_DEPTH] = {};
+        CaptureStack(stack);
+
+        CallSite* callSite = FindCallSite(stack);
+        if (callSite == nullptr) {
+            m_droppedSampleCount++;
+        } else {
+            // Allocations bigger than the interval are always sampled, smaller ones represent a whole interval
+            callSite->Samples++;
+            callSite->Bytes += Stdlib::Max(size, m_sampleInterval);
+            m_sampleCount++;
+        }
+
+        m_sampling = false;
+    }
+
+    void HeapProfiler::CaptureStack(uintptr_t* stack) const noexcept {
+        // Every frame starts with the frame pointer of the caller, followed by the return address
+        const auto* frame = static_cast<const uintptr_t*>(F_FETCH_FRAME_ADDRESS());
+        size_t depth      = 0;
+
+        while (depth < PROFILER_FRAMES + SKIPPED_FRAMES + STACK_DEPTH) {
+            const auto frameAddress = reinterpret_cast<uintptr_t>(frame);
+            if (frameAddress < m_stackBottom || frameAddress + 2 * sizeof(uintptr_t) > m_stackTop ||
+                (frameAddress % sizeof(uintptr_t)) != 0) {
+                break;
+            }
+
+            if (depth >= PROFILER_FRAMES + SKIPPED_FRAMES) {
+                stack[depth - PROFILER_FRAMES - SKIPPED_FRAMES] = frame[1];
+            }
+
+            // The stack grows down, so the frames of the callers are always above
+            const auto* callerFrame = reinterpret_cast<const uintptr_t*>(frame[0]);
+            if (callerFrame <= frame) {
+                break;
+            }
+
+            frame = callerFrame;
+            depth++;
+        }
+    }
+
+    HeapProfiler::CallSite* HeapProfiler::FindCallSite(const uintptr_t* stack) noexcept {
+        const size_t start = HashStack(stack) % CALL_SITE_COUNT;
+
+        for (size_t probe = 0; probe < CALL_SITE_COUNT; probe++) {
+            CallSite& callSite = m_callSites[(start + probe) % CALL_SITE_COUNT];
+
+            if (callSite.Samples == 0) {
+                Stdlib::Memory::Copy(callSite.Stack, stack, STACK_DEPTH);
+                return &callSite;
+            }
+
+            if (IsSameStack(callSite.Stack, stack)) {
+                return &callSite;
+            }
+        }
+
+        return nullptr;
+    }
+
+    size_t HeapProfiler::NextSampleDistance() noexcept {
+        if (m_sampleInterval == 0) {
+            return NEVER_SAMPLE;
+        }
+
+        // xorshift64, uniformly distributed in [interval / 2, interval * 3 / 2)
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 7;
+        m_randomState ^= m_randomState << 17;
+
+        return m_sampleInterval / 2 + static_cast<size_t>(m_randomState % m_sampleInterval);
+    }
+
+}  // namespace FunnyOS::Kernel::MM
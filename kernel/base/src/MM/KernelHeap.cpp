@@ -0,0 +1,141 @@
+#include <FunnyOS/Kernel/MM/KernelHeap.hpp>
+
+#include <FunnyOS/Stdlib/Algorithm.hpp>
+#include <FunnyOS/Stdlib/Math.hpp>
+
+namespace FunnyOS::Kernel::MM {
+    namespace {
+        /**
+         * Extra memory requested when growing, enough for the allocator bookkeeping of a single block.
+         */
+        constexpr const size_t GROW_OVERHEAD = 64;
+    }  // namespace
+
+    void KernelHeap::Initialize(memoryaddress_t memoryStart, memoryaddress_t memoryEnd) noexcept {
+        F_ASSERT_NOEXCEPT((memoryStart % PAGE_SIZE) == 0, "kernel heap start not page aligned");
+        F_ASSERT_NOEXCEPT((memoryEnd % PAGE_SIZE) == 0, "kernel heap end not page aligned");
+
+        m_allocator.Initialize(memoryStart, memoryEnd);
+        m_initialMemoryEnd = memoryEnd;
+        m_maximumMemoryEnd = Stdlib::Max<memoryaddress_t>(memoryEnd, memoryStart + KERNEL_HEAP_MAX_SIZE);
+    }
+
+    void KernelHeap::EnableGrowth(VirtualMemoryManager& vmm, PhysicalMemoryManager& pmm) noexcept {
+        m_virtualMemoryManager  = &vmm;
+        m_physicalMemoryManager = &pmm;
+    }
+
+    void* KernelHeap::Allocate(size_t size, size_t alignment) noexcept {
+        void* memory = m_allocator.Allocate(size, alignment);
+
+        if (memory == nullptr && Grow(size, alignment)) {
+            memory = m_allocator.Allocate(size, alignment);
+        }
+
+        return memory;
+    }
+
+    void KernelHeap::Free(void* ptr) noexcept {
+        m_allocator.Free(ptr);
+        ShrinkIfPossible();
+    }
+
+    void* KernelHeap::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
+        void* memory = m_allocator.Reallocate(ptr, size, alignment);
+
+        if (memory == nullptr && Grow(size, alignment)) {
+            memory = m_allocator.Reallocate(ptr, size, alignment);
+        }
+
+        if (memory != nullptr && memory != ptr) {
+            ShrinkIfPossible();
+        }
+
+        return memory;
+    }
+
+    size_t KernelHeap::GetTotalFreeMemory() const noexcept {
+        return m_allocator.GetTotalFreeMemory();
+    }
+
+    size_t KernelHeap::GetAllocatedMemory() const noexcept {
+        return m_allocator.GetAllocatedMemory();
+    }
+
+    size_t KernelHeap::GetTotalAvailableMemory() const noexcept {
+        return m_allocator.GetTotalAvailableMemory();
+    }
+
+    size_t KernelHeap::GetMemoryBlockSize(void* ptr) {
+        return m_allocator.GetMemoryBlockSize(ptr);
+    }
+
+    const Misc::MemoryAllocator::StaticMemoryAllocator& KernelHeap::GetAllocator() const noexcept {
+        return m_allocator;
+    }
+
+    bool KernelHeap::Grow(size_t size, size_t alignment) noexcept {
+        // Growing may need memory for new page tables, never grow recursively.
+        if (m_virtualMemoryManager == nullptr || m_resizing) {
+            return false;
+        }
+
+        const memoryaddress_t memoryEnd = m_allocator.GetMemoryEnd();
+        const memoryaddress_t neededEnd = m_allocator.GetCurrentMemoryTop() + size + alignment + GROW_OVERHEAD;
+
+        if (neededEnd <= memoryEnd || memoryEnd >= m_maximumMemoryEnd) {
+            return false;
+        }
+
+        const size_t chunks = Stdlib::Math::DivideRoundUp<size_t>(neededEnd - memoryEnd, KERNEL_HEAP_GROW_SIZE);
+        const memoryaddress_t newEnd =
+            Stdlib::Min<memoryaddress_t>(memoryEnd + chunks * KERNEL_HEAP_GROW_SIZE, m_maximumMemoryEnd);
+
+        m_resizing = true;
+
+        memoryaddress_t mappedEnd = memoryEnd;
+        while (mappedEnd < newEnd) {
+            const physicaladdress_t page = m_physicalMemoryManager->AllocatePage();
+            if (page == NULL_ADDRESS) {
+                break;
+            }
+
+            m_virtualMemoryManager->Map4KbPage(
+                page, mappedEnd, static_cast<PageAttributes>(PAGE_WRITABLE | PAGE_KERNEL));
+            mappedEnd += PAGE_SIZE;
+        }
+
+        m_allocator.SetMemoryEnd(mappedEnd);
+        m_resizing = false;
+
+        return mappedEnd != memoryEnd;
+    }
+
+    void KernelHeap::ShrinkIfPossible() noexcept {
+        if (m_virtualMemoryManager == nullptr || m_resizing) {
+            return;
+        }
+
+        const memoryaddress_t memoryEnd = m_allocator.GetMemoryEnd();
+        const memoryaddress_t keptEnd   = Stdlib::Max<memoryaddress_t>(
+            m_initialMemoryEnd, AlignToPage(m_allocator.GetCurrentMemoryTop()) + KERNEL_HEAP_GROW_SIZE);
+
+        if (keptEnd >= memoryEnd || memoryEnd - keptEnd < KERNEL_HEAP_GROW_SIZE) {
+            return;
+        }
+
+        m_resizing = true;
+        m_allocator.SetMemoryEnd(keptEnd);
+
+        for (memoryaddress_t page = keptEnd; page < memoryEnd; page += PAGE_SIZE) {
+            const physicaladdress_t physicalPage = m_virtualMemoryManager->Unmap4KbPage(page);
+
+            if (physicalPage != NULL_ADDRESS) {
+                m_physicalMemoryManager->FreePage(physicalPage);
+            }
+        }
+
+        m_resizing = false;
+    }
+
+}  // namespace FunnyOS::Kernel::MM
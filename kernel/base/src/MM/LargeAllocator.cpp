@@ -0,0 +1,114 @@
+#include <FunnyOS/Kernel/MM/LargeAllocator.hpp>
+
+#include <FunnyOS/Stdlib/Math.hpp>
+
+namespace FunnyOS::Kernel::MM {
+    namespace {
+        constexpr const size_t TABLE_MASK = LargeAllocator::MAXIMUM_ALLOCATIONS - 1;
+        static_assert((LargeAllocator::MAXIMUM_ALLOCATIONS & TABLE_MASK) == 0, "table size must be a power of two");
+
+        /**
+         * Maximum amount of allocations, keeps the side table at most 3/4 full so the probe sequences stay short.
+         */
+        constexpr const size_t MAXIMUM_USED_ENTRIES = LargeAllocator::MAXIMUM_ALLOCATIONS / 4 * 3;
+
+        inline size_t GetHomeIndex(uintptr_t address) {
+            // Addresses are page aligned, drop the bits that are always 0
+            return static_cast<size_t>(((address / PAGE_SIZE) * 0x9E3779B97F4A7C15) >> 32) & TABLE_MASK;
+        }
+    }  // namespace
+
+    LargeAllocator::LargeAllocator(PhysicalMemoryManager& pmm) noexcept
+        : m_physicalMemoryManager(pmm), m_enabled(false), m_allocationCount(0), m_allocations() {}
+
+    void LargeAllocator::Enable() noexcept {
+        m_enabled = true;
+    }
+
+    bool LargeAllocator::IsLargeAllocation(size_t size) const noexcept {
+        return m_enabled && size >= LARGE_ALLOCATION_THRESHOLD;
+    }
+
+    void* LargeAllocator::Allocate(size_t size, size_t alignment) noexcept {
+        if (!m_enabled || alignment > PAGE_SIZE || m_allocationCount >= MAXIMUM_USED_ENTRIES) {
+            return nullptr;
+        }
+
+        const size_t pages                = Stdlib::Math::DivideRoundUp(size, PAGE_SIZE);
+        const physicaladdress_t firstPage = m_physicalMemoryManager.AllocatePagesRaw(pages);
+        if (firstPage == NULL_ADDRESS) {
+            return nullptr;
+        }
+
+        void* memory       = PhysicalAddressToPointer(firstPage);
+        const auto address = reinterpret_cast<uintptr_t>(memory);
+        Allocation& entry  = m_allocations[FindEntry(address)];
+        entry.Address      = address;
+        entry.Pages        = pages;
+        m_allocationCount++;
+
+        return memory;
+    }
+
+    void LargeAllocator::Free(void* ptr) noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        const size_t index = FindEntry(address);
+        F_ASSERT_NOEXCEPT(m_allocations[index].Address == address, "freeing memory not owned by the large allocator");
+
+        m_physicalMemoryManager.FreePagesRaw(address - F_KERNEL_PHYSICAL_MAPPING_ADDRESS, m_allocations[index].Pages);
+        RemoveEntry(index);
+        m_allocationCount--;
+    }
+
+    bool LargeAllocator::Owns(const void* ptr) const noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+
+        // Cheap checks first, so heap pointers are rejected without touching the side table
+        if (m_allocationCount == 0 || address < F_KERNEL_PHYSICAL_MAPPING_ADDRESS || (address % PAGE_SIZE) != 0) {
+            return false;
+        }
+
+        return m_allocations[FindEntry(address)].Address == address;
+    }
+
+    size_t LargeAllocator::GetAllocationSize(const void* ptr) const noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+        const size_t index = FindEntry(address);
+        F_ASSERT_NOEXCEPT(m_allocations[index].Address == address, "memory not owned by the large allocator");
+
+        return m_allocations[index].Pages * PAGE_SIZE;
+    }
+
+    size_t LargeAllocator::GetAllocationCount() const noexcept {
+        return m_allocationCount;
+    }
+
+    size_t LargeAllocator::FindEntry(uintptr_t address) const noexcept {
+        size_t index = GetHomeIndex(address);
+
+        // The table is never full, so an unused entry always ends the probe sequence
+        while (m_allocations[index].Address != 0 && m_allocations[index].Address != address) {
+            index = (index + 1) & TABLE_MASK;
+        }
+
+        return index;
+    }
+
+    void LargeAllocator::RemoveEntry(size_t index) noexcept {
+        size_t hole = index;
+
+        for (size_t next = (hole + 1) & TABLE_MASK; m_allocations[next].Address != 0; next = (next + 1) & TABLE_MASK) {
+            // An entry can be moved to the hole only if its home index is not between the hole and the entry
+            const size_t home = GetHomeIndex(m_allocations[next].Address);
+
+            if (((next - home) & TABLE_MASK) >= ((next - hole) & TABLE_MASK)) {
+                m_allocations[hole] = m_allocations[next];
+                hole                = next;
+            }
+        }
+
+        m_allocations[hole].Address = 0;
+        m_allocations[hole].Pages   = 0;
+    }
+
+}  // namespace FunnyOS::Kernel::MM
@@ -136,6 +136,48 @@ namespace FunnyOS::Kernel::MM {
             }
         }
 
+        /**
+         * Amount of entries in every paging structure.
+         */
+        constexpr const size_t ENTRIES_PER_STRUCTURE = 512;
+
+        /**
+         * Flags of a page table entry that are set by the processor and do not describe the mapping itself.
+         */
+        constexpr const uint64_t PAGE_TABLE_VOLATILE_FLAGS =
+            static_cast<uint64_t>(PageStructureFlags::Accessed) | static_cast<uint64_t>(PageStructureFlags::Dirty);
+
+        /**
+         * Bit 7 in page table entries is the PAT bit, in page directory entries it is the PageSize bit and the PAT bit
+         * is moved to bit 12. Page tables using PAT are never promoted.
+         */
+        constexpr const uint64_t PAGE_TABLE_PAT_BIT = (1ULL << 7);
+
+        /**
+         * Invalidates a single TLB entry.
+         *
+         * @param virtualAddress address inside the page to invalidate
+         */
+        inline void InvalidatePage(uintptr_t virtualAddress) {
+#ifdef __GNUC__
+            asm volatile("invlpg (%0)" ::"r"(virtualAddress) : "memory");
+#endif
+        }
+
+        /**
+         * Converts paging structure indexes to a canonical virtual address.
+         */
+        inline uintptr_t IndexesToVirtualAddress(size_t pml4Index, size_t pdptIndex, size_t pdIndex) {
+            uintptr_t address = (pml4Index << 39) | (pdptIndex << 30) | (pdIndex << 21);
+
+            // Sign-extend bit 47
+            if ((address & (1ULL << 47)) != 0) {
+                address |= 0xFFFF000000000000;
+            }
+
+            return address;
+        }
+
     }  // namespace
 
     void VirtualMemoryManager::FlushTLB() {
@@ -267,6 +309,83 @@ namespace FunnyOS::Kernel::MM {
         *entry |= static_cast<uint64_t>(PageStructureFlags::PageSize);
     }
 
+    physicaladdress_t VirtualMemoryManager::Unmap4KbPage(uintptr_t virtualAddress) {
+        static constexpr const uint64_t c_restrictedFlags = static_cast<uint64_t>(PageStructureFlags::PageSize) |
+                                                            static_cast<uint64_t>(PageStructureFlags::ExEmulatePdpe1Gb);
+
+        if ((virtualAddress % PAGE_SIZE) != 0) {
+            F_ERROR_WITH_MESSAGE(PageSetupFailure, VMM_PREFIX "Virtual address not aligned to 4KB");
+        }
+
+        physicaladdress_t current = m_pageTableBase;
+
+        for (unsigned int level = 4; level > 1; level--) {
+            const size_t index   = (virtualAddress >> (12 + (level - 1) * 9)) & 0x1FF;
+            const uint64_t entry = PhysicalAddressToPointer<uint64_t>(current)[index];
+
+            // Pages promoted by TryPromotePageTable are not ExAllocated, so the page size is checked first
+            if ((entry & c_restrictedFlags) != 0) {
+                F_ERROR_WITH_MESSAGE(PageSetupFailure, VMM_PREFIX "tried to unmap a 4KB page inside a bigger page");
+            }
+
+            if ((entry & static_cast<uint64_t>(PageStructureFlags::ExAllocated)) == 0) {
+                return NULL_ADDRESS;
+            }
+
+            current = entry & PHYSICAL_ADDRESS_MASK_PAGE_TABLE;
+        }
+
+        uint64_t* entry = PhysicalAddressToPointer<uint64_t>(current) + ((virtualAddress >> 12) & 0x1FF);
+        if ((*entry & static_cast<uint64_t>(PageStructureFlags::Present)) == 0) {
+            return NULL_ADDRESS;
+        }
+
+        const physicaladdress_t physicalAddress = *entry & PHYSICAL_ADDRESS_MASK_PAGE_TABLE;
+        *entry                                  = 0;
+        InvalidatePage(virtualAddress);
+
+        return physicalAddress;
+    }
+
+    size_t VirtualMemoryManager::PromoteHugePages() {
+        static constexpr const uint64_t c_skippedFlags = static_cast<uint64_t>(PageStructureFlags::PageSize) |
+                                                         static_cast<uint64_t>(PageStructureFlags::ExEmulatePdpe1Gb);
+
+        size_t promoted = 0;
+        auto* pml4      = PhysicalAddressToPointer<uint64_t>(m_pageTableBase);
+
+        for (size_t pml4Index = 0; pml4Index < ENTRIES_PER_STRUCTURE; pml4Index++) {
+            if ((pml4[pml4Index] & static_cast<uint64_t>(PageStructureFlags::ExAllocated)) == 0) {
+                continue;
+            }
+
+            auto* pdpt = PhysicalAddressToPointer<uint64_t>(pml4[pml4Index] & PHYSICAL_ADDRESS_MASK_PAGE_TABLE);
+
+            for (size_t pdptIndex = 0; pdptIndex < ENTRIES_PER_STRUCTURE; pdptIndex++) {
+                if ((pdpt[pdptIndex] & static_cast<uint64_t>(PageStructureFlags::ExAllocated)) == 0 ||
+                    (pdpt[pdptIndex] & c_skippedFlags) != 0) {
+                    continue;
+                }
+
+                auto* pd = PhysicalAddressToPointer<uint64_t>(pdpt[pdptIndex] & PHYSICAL_ADDRESS_MASK_PAGE_TABLE);
+
+                for (size_t pdIndex = 0; pdIndex < ENTRIES_PER_STRUCTURE; pdIndex++) {
+                    if ((pd[pdIndex] & static_cast<uint64_t>(PageStructureFlags::ExAllocated)) == 0 ||
+                        (pd[pdIndex] & static_cast<uint64_t>(PageStructureFlags::PageSize)) != 0) {
+                        continue;
+                    }
+
+                    if (TryPromotePageTable(&pd[pdIndex], IndexesToVirtualAddress(pml4Index, pdptIndex, pdIndex))) {
+                        promoted++;
+                    }
+                }
+            }
+        }
+
+        FK_LOG_DEBUG_F(VMM_PREFIX "Promoted %llu page tables to 2 MB pages", static_cast<uint64_t>(promoted));
+        return promoted;
+    }
+
     bool VirtualMemoryManager::NxSupported() {
         static bool c_nxSupported =
             HW::CPU::GetExtendedFeatureBits() & static_cast<uint64_t>(HW::CPU::CPUIDExtendedFeatures::NX);
@@ -319,6 +438,48 @@ namespace FunnyOS::Kernel::MM {
         return base;
     }
 
+    bool VirtualMemoryManager::TryPromotePageTable(uint64_t* directoryEntry, uintptr_t virtualAddress) {
+        const physicaladdress_t pageTable = *directoryEntry & PHYSICAL_ADDRESS_MASK_PAGE_TABLE;
+        auto* entries                     = PhysicalAddressToPointer<uint64_t>(pageTable);
+
+        const uint64_t first = entries[0];
+        if ((first & static_cast<uint64_t>(PageStructureFlags::Present)) == 0 || (first & PAGE_TABLE_PAT_BIT) != 0) {
+            return false;
+        }
+
+        const physicaladdress_t base = first & PHYSICAL_ADDRESS_MASK_PAGE_TABLE;
+        if ((base % PAGE_SIZE_2MB) != 0) {
+            return false;
+        }
+
+        const uint64_t attributes = first & ~PHYSICAL_ADDRESS_MASK_PAGE_TABLE & ~PAGE_TABLE_VOLATILE_FLAGS;
+
+        for (size_t i = 1; i < ENTRIES_PER_STRUCTURE; i++) {
+            const uint64_t entry = entries[i];
+
+            if ((entry & PHYSICAL_ADDRESS_MASK_PAGE_TABLE) != base + i * PAGE_SIZE) {
+                return false;
+            }
+
+            if ((entry & ~PHYSICAL_ADDRESS_MASK_PAGE_TABLE & ~PAGE_TABLE_VOLATILE_FLAGS) != attributes) {
+                return false;
+            }
+        }
+
+        // The page table attributes map directly to the page directory entry attributes, Global and NX included.
+        *directoryEntry = base | attributes | static_cast<uint64_t>(PageStructureFlags::PageSize);
+
+        for (size_t i = 0; i < ENTRIES_PER_STRUCTURE; i++) {
+            InvalidatePage(virtualAddress + i * PAGE_SIZE);
+        }
+
+        m_pmm.FreePage(pageTable);
+
+        FK_LOG_DEBUG_F(
+            VMM_PREFIX "Promoted 0x%016llx -> 0x%016llx to a 2 MB page", static_cast<uint64_t>(virtualAddress), base);
+        return true;
+    }
+
     physicaladdress_t VirtualMemoryManager::GetPageStructure(
         uintptr_t virtualAddress, unsigned int target, bool skipChecks) {
         return GetPageStructureRecursively(m_pageTableBase, virtualAddress, 4, target, skipChecks);
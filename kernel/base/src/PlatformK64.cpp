@@ -1,4 +1,6 @@
 #include <FunnyOS/Stdlib/IntegerTypes.hpp>
+#include <FunnyOS/Stdlib/Algorithm.hpp>
+#include <FunnyOS/Stdlib/Memory.hpp>
 
 #include <FunnyOS/Kernel/Kernel.hpp>
 
@@ -8,17 +10,83 @@
 namespace FunnyOS::_Platform {
     using namespace FunnyOS::Stdlib;
 
-    // TODO
+    namespace {
+        using Kernel::MM::LargeAllocator;
+
+        void* Allocate(size_t size, size_t alignment) noexcept {
+            Kernel::Kernel64& kernel = Kernel::Kernel64::Get();
+
+            // Big allocations go straight to the page allocator, if it cannot serve them they go to the heap
+            if (kernel.GetLargeAllocator().IsLargeAllocation(size)) {
+                void* memory = kernel.GetLargeAllocator().Allocate(size, alignment);
+                if (memory != nullptr) {
+                    return memory;
+                }
+            }
+
+            return kernel.GetCurrentCpuHeapCache().Allocate(size, alignment);
+        }
+
+        void Free(void* memory) noexcept {
+            Kernel::Kernel64& kernel = Kernel::Kernel64::Get();
+
+            if (kernel.GetLargeAllocator().Owns(memory)) {
+                kernel.GetLargeAllocator().Free(memory);
+                return;
+            }
+
+            kernel.GetCurrentCpuHeapCache().Free(memory);
+        }
+
+        /**
+         * Reallocates memory between the heap and the large allocator, by copying it.
+         */
+        void* MoveAllocation(void* memory, size_t oldSize, size_t size, size_t alignment) noexcept {
+            void* newMemory = Allocate(size, alignment);
+            if (newMemory == nullptr) {
+                return nullptr;
+            }
+
+            Memory::Copy(newMemory, memory, Min(oldSize, size));
+            Free(memory);
+            return newMemory;
+        }
+    }  // namespace
+
     void* AllocateMemoryAligned(size_t size, size_t aligned) noexcept {
-        return Kernel::Kernel64::Get().GetKernelAllocator().Allocate(size, aligned);
+        Kernel::Kernel64::Get().GetHeapProfiler().RecordAllocation(size);
+        return Allocate(size, aligned);
     }
 
     void* ReallocateMemoryAligned(void* memory, size_t size, size_t alignment) noexcept {
-        return Kernel::Kernel64::Get().GetKernelAllocator().Reallocate(memory, size, alignment);
+        Kernel::Kernel64& kernel       = Kernel::Kernel64::Get();
+        LargeAllocator& largeAllocator = kernel.GetLargeAllocator();
+        kernel.GetHeapProfiler().RecordAllocation(size);
+
+        if (memory == nullptr) {
+            return Allocate(size, alignment);
+        }
+
+        if (largeAllocator.Owns(memory)) {
+            const size_t oldSize = largeAllocator.GetAllocationSize(memory);
+
+            // The page run is kept as long as the memory fits in it and is still big
+            if (size <= oldSize && largeAllocator.IsLargeAllocation(size)) {
+                return memory;
+            }
+
+            return MoveAllocation(memory, oldSize, size, alignment);
+        }
+
+        if (largeAllocator.IsLargeAllocation(size)) {
+            return MoveAllocation(memory, kernel.GetKernelAllocator().GetMemoryBlockSize(memory), size, alignment);
+        }
+
+        return kernel.GetCurrentCpuHeapCache().Reallocate(memory, size, alignment);
     }
 
     void FreeMemory(void* memory) noexcept {
-        return Kernel::Kernel64::Get().GetKernelAllocator().Free(memory);
+        Free(memory);
     }
 
     void ReportError(const char* error) noexcept {
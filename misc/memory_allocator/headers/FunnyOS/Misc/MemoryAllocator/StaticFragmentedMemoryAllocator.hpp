@@ -25,6 +25,9 @@ namespace FunnyOS::Misc::MemoryAllocator {
 
     /**
      * An IMemoryAllocator implementation that uses multiple StaticMemoryAllocators to allocate in fragmented memory.
+     *
+     * The member allocators are sorted by their memory start, so the allocator owning a memory address is found with
+     * a binary search. Allocate skips member allocators whose largest free block hint is too small for the request.
      */
     class StaticFragmentedMemoryAllocator : public IMemoryAllocator {
        public:
@@ -47,11 +50,38 @@ namespace FunnyOS::Misc::MemoryAllocator {
 
         size_t GetTotalAvailableMemory() const noexcept override;
 
+        /**
+         * Returns the member allocators, sorted by their memory start.
+         *
+         * @return the member allocators
+         */
         const Stdlib::Vector<StaticMemoryAllocator>& GetMemberAllocators() const;
 
+        /**
+         * Returns the member allocators, sorted by their memory start.
+         *
+         * @return the member allocators
+         */
         Stdlib::Vector<StaticMemoryAllocator>& GetMemberAllocators();
 
        private:
+        /**
+         * Finds the index of the first member allocator whose memory starts after the given address, using a binary
+         * search.
+         *
+         * @param address address to look up
+         * @return index of the first member allocator starting after the address, or the amount of allocators if none
+         */
+        [[nodiscard]] size_t FindUpperBound(memoryaddress_t address) const noexcept;
+
+        /**
+         * Finds the member allocator that owns the given address.
+         *
+         * @param address address to look up
+         * @return the owning allocator or nullptr if the address is not owned by any member allocator
+         */
+        [[nodiscard]] StaticMemoryAllocator* FindAllocator(memoryaddress_t address) noexcept;
+
         void* DoReallocate(StaticMemoryAllocator& alloc, void* ptr, size_t size, size_t alignment);
 
        private:
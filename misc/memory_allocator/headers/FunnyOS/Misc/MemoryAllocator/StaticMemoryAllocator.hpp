@@ -5,6 +5,14 @@
 
 #include "MemoryAllocator.hpp"
 
+/**
+ * If defined every memory block also holds a MemoryMetaStatus magic that is verified on every operation, so corrupted
+ * blocks can be detected. This doubles the size of the block header, so it is only enabled by default in debug builds.
+ */
+#if defined(F_DEBUG) && !defined(F_MEMORY_ALLOCATOR_STATUS_MAGIC)
+#   define F_MEMORY_ALLOCATOR_STATUS_MAGIC
+#endif
+
 namespace FunnyOS::Misc::MemoryAllocator {
 
     /**
@@ -18,34 +26,46 @@ namespace FunnyOS::Misc::MemoryAllocator {
      * Memory meta block. This block is guaranteed to be present just before an allocated memory region.
      */
     struct MemoryMetaBlock {
+#ifdef F_MEMORY_ALLOCATOR_STATUS_MAGIC
         /**
-         * Status of the memory block.
+         * Status of the memory block, only present if F_MEMORY_ALLOCATOR_STATUS_MAGIC is defined.
          */
         MemoryMetaStatus Status;
+#endif
 
         /**
-         * Size of the block in bytes.
+         * Size of the block memory in bytes. The lowest bit is set if the block is Freed, the second lowest bit is
+         * set if the block that directly precedes this block is Freed.
          */
-        memoryaddress_t BlockSize;
-
-        /**
-         * If Status == Freed, then this points to the next free block in the memory or is 0 if this is the last free
-         * block.
-         * If Status == Taken, this is always 0
-         */
-        memoryaddress_t NextFreeBlock;
+        memoryaddress_t SizeAndFlags;
+    };
 
+    /**
+     * Boundary tag, present at the end of the memory of every Freed block. It allows to find and merge the previous
+     * block in the memory without walking any lists.
+     */
+    struct MemoryBoundaryTag {
         /**
-         * Gets the next free block (from memory address NextFreeBlock), or nullptr if NextFreeBlock is 0
+         * Size of the block memory in bytes.
          */
-        [[nodiscard]] MemoryMetaBlock* GetNext() const noexcept;
+        memoryaddress_t BlockSize;
     };
 
     /**
      * Simple and efficient memory allocator, tracking all free blocks and merging them if possible.
+     *
+     * Free blocks are kept in segregated lists, one for each size class, and a bitmap of non-empty size classes is
+     * used to find a suitable block without walking over blocks that are too small. Every block starts with a single
+     * word MemoryMetaBlock. Links of the free lists and the MemoryBoundaryTag are stored in the memory of Freed blocks
+     * only, so both neighbours of a freed block can be merged in constant time without any overhead for Taken blocks.
      */
     class StaticMemoryAllocator : public IMemoryAllocator {
        public:
+        /**
+         * Amount of size classes, each size class has its own list of free blocks.
+         */
+        static constexpr const size_t SIZE_CLASS_COUNT = 64;
+
         /**
          * Initializes the memory allocator.
          *
@@ -66,6 +86,19 @@ namespace FunnyOS::Misc::MemoryAllocator {
 
         size_t GetTotalAvailableMemory() const noexcept override;
 
+        /**
+         * Tries to change the size of a memory block without moving it.
+         *
+         * Shrinking splits the end of the block off, growing either takes memory from a free block that directly
+         * follows it or, if the block is the top-most one, from the unallocated memory.
+         *
+         * @param ptr ptr returned by Allocate
+         * @param size new size of the block
+         * @param alignment required alignment of the block memory
+         * @return whether or not the block was resized, if not the block is left unchanged
+         */
+        bool TryReallocateInPlace(void* ptr, size_t size, size_t alignment) noexcept;
+
         /**
          * Gets a size of a memory block that was allocated using Allocate before.
          *
@@ -73,6 +106,15 @@ namespace FunnyOS::Misc::MemoryAllocator {
          */
         size_t GetMemoryBlockSize(void *ptr);
 
+        /**
+         * Gets an upper bound of the size of the biggest block that can be currently allocated by this allocator.
+         * Any Allocate call with a bigger size is guaranteed to fail. The value is computed in constant time from the
+         * non-empty size classes and the unallocated memory.
+         *
+         * @return upper bound of the biggest possible allocation
+         */
+        [[nodiscard]] size_t GetLargestFreeBlockHint() const noexcept;
+
         /**
          * Gets the highest memory address that this allocator ever allocated.
          * That is the (highest address + 1) of the top-most block.
@@ -98,32 +140,64 @@ namespace FunnyOS::Misc::MemoryAllocator {
          */
         [[nodiscard]] memoryaddress_t GetMemoryEnd() const noexcept;
 
+        /**
+         * Moves the top memory boundary of this allocator. This allows the memory available to the allocator to grow
+         * or shrink after it was initialized.
+         *
+         * @param memoryEnd[in] new highest address this allocator can use, exclusive. Must not be lower than
+         * GetCurrentMemoryTop()
+         */
+        void SetMemoryEnd(memoryaddress_t memoryEnd) noexcept;
+
        private:
         /**
-         * Finds a block of a size equal or greater than size and returns a block that precedes it in the free memory
-         * list.
+         * Finds a free block of a size equal or greater than size, whose memory is aligned to [alignment].
+         *
+         * Size classes that guarantee a fit are checked first, using the bitmap of non-empty size classes. Only if
+         * none of them have a suitable block, the size classes that may hold a suitable block are searched.
+         *
+         * The memory of the returned block is not necessarily aligned, but an aligned block of size [size] can be
+         * carved out of it with SplitAlignedBlock.
          *
-         * @param[in] size minimum size of the block
-         * @return suitable block predecessor or nullptr
+         * @param[in] size minimum size of the block, must be already rounded by RoundBlockSize
+         * @param[in] alignment required alignment of the block memory
+         * @return suitable free block or nullptr
          */
-        [[nodiscard]] MemoryMetaBlock* FindFreeBlockPredecessor(size_t size, size_t alignment) noexcept;
+        [[nodiscard]] MemoryMetaBlock* FindFreeBlock(size_t size, size_t alignment) noexcept;
 
         /**
-         * Splits the successor of the given free block in two blocks.
+         * Splits a free block so its memory is aligned to [alignment]. The memory before the aligned memory forms a
+         * new free block, that is put to the free memory lists.
+         *
+         * @param[in] block the free block to be aligned, it must be able to hold an aligned block
+         * @return a free block, whose memory is aligned to [alignment]. Never nullptr.
+         */
+        [[nodiscard]] MemoryMetaBlock* SplitAlignedBlock(MemoryMetaBlock* block, size_t alignment) noexcept;
+
+        /**
+         * Splits the given free block in two blocks.
          * If the block is possible to split then the resulting blocks are:
-         * - the first one has a size of minimum [size], is marked as Taken and removed from free memory list.
-         * - the second one has a size of [original block size - size - sizeof(MemoryMetaBlock)] and is put to the free
-         * memory list.
+         * - the first one has a size of minimum [size], is marked as Taken and removed from free memory lists.
+         * - the second one has a size of [original block size - size - block overhead] and is put to the free memory
+         * lists.
          *
-         * If the block is impossible to split the successor is marked as Taken, remove from free memory list and
+         * If the block is impossible to split the block is marked as Taken, removed from free memory lists and
          * returned.
          *
-         * @param[in] predecessor predecessor of the block to be split.
+         * @param[in] block the free block to be split.
          * @param[in] size minimum size of the returned block
          * @return a memory block marked as Taken of size greater or equal [size]. Never nullptr.
          */
-        [[nodiscard]] MemoryMetaBlock* SplitBlockAndTakeItIfPossible(
-            MemoryMetaBlock* predecessor, size_t size) noexcept;
+        [[nodiscard]] MemoryMetaBlock* SplitBlockAndTakeItIfPossible(MemoryMetaBlock* block, size_t size) noexcept;
+
+        /**
+         * Shrinks a Taken block to the given size, if the remaining memory is big enough to form a new block it is
+         * freed.
+         *
+         * @param[in] block the block to be shrunk
+         * @param[in] size new size of the block, must be already rounded by RoundBlockSize
+         */
+        void ShrinkBlock(MemoryMetaBlock* block, size_t size) noexcept;
 
         /**
          * Allocates a new block after the end of the last allocated block.
@@ -134,22 +208,63 @@ namespace FunnyOS::Misc::MemoryAllocator {
         [[nodiscard]] MemoryMetaBlock* AllocateNewBlock(size_t size, size_t alignment) noexcept;
 
         /**
-         * Merges clumps of Freed marked zones in the free memory list to bigger clumps.
+         * Inserts a free block to the free list of its size class.
          *
-         * @return whether or not at least one merge occurred.
+         * @param[in] block block to be inserted
          */
-        bool MergeMemory() noexcept;
+        void InsertIntoSizeClass(MemoryMetaBlock* block) noexcept;
+
+        /**
+         * Removes a free block from the free list of its size class.
+         *
+         * @param[in] block block to be removed
+         */
+        void RemoveFromSizeClass(MemoryMetaBlock* block) noexcept;
+
+        /**
+         * Gets the block that directly follows the given block in the memory.
+         *
+         * @param[in] block block to get the successor of
+         * @return the next block or nullptr if [block] is the top-most block
+         */
+        [[nodiscard]] MemoryMetaBlock* GetNextBlock(MemoryMetaBlock* block) const noexcept;
+
+        /**
+         * Gets the block that directly precedes the given block in the memory, if it is Freed.
+         *
+         * @param[in] block block to get the predecessor of
+         * @return the previous block or nullptr if [block] is the first block or the previous block is not Freed
+         */
+        [[nodiscard]] MemoryMetaBlock* GetPreviousFreeBlock(MemoryMetaBlock* block) const noexcept;
+
+        /**
+         * Merges a free block with the block that directly follows it in the memory. The next block must be already
+         * removed from its size class. The boundary tag of the merged block is not updated.
+         *
+         * @param[in] block block to be merged with its successor
+         * @param[in] nextBlock the successor of [block]
+         */
+        void MergeBlocks(MemoryMetaBlock* block, MemoryMetaBlock* nextBlock) noexcept;
 
        private:
-        MemoryMetaBlock* m_firstFreeBlock;
-        MemoryMetaBlock* m_lastFreeBlock;
         memoryaddress_t m_currentMemory;
         memoryaddress_t m_memoryStart;
         memoryaddress_t m_memoryEnd;
         size_t m_totalMemory;
         size_t m_usedMemory;
+        MemoryMetaBlock* m_sizeClasses[SIZE_CLASS_COUNT];
+        uint64_t m_nonEmptySizeClasses;
     };
 
 }  // namespace FunnyOS::Misc::MemoryAllocator
 
+namespace FunnyOS::Stdlib {
+    /**
+     * The free lists live in the managed memory, so an allocator can be moved by copying its bytes. This lets a vector
+     * of allocators grow, even though they cannot be moved otherwise.
+     */
+    template <>
+    constexpr bool IsTriviallyRelocatable<Misc::MemoryAllocator::StaticMemoryAllocator> = true;
+}  // namespace FunnyOS::Stdlib
+
 #endif  // FUNNYOS_MISC_MEMORY_ALLOCATOR_HEADERS_FUNNYOS_MISC_MEMORYALLOCATOR_STATICMEMORYALLOCATOR_HPP
@@ -0,0 +1,189 @@
+#ifndef FUNNYOS_MISC_MEMORY_ALLOCATOR_HEADERS_FUNNYOS_MISC_MEMORYALLOCATOR_TRACINGMEMORYALLOCATOR_HPP
+#define FUNNYOS_MISC_MEMORY_ALLOCATOR_HEADERS_FUNNYOS_MISC_MEMORYALLOCATOR_TRACINGMEMORYALLOCATOR_HPP
+
+#include <FunnyOS/Stdlib/IntegerTypes.hpp>
+#include <FunnyOS/Stdlib/Memory.hpp>
+
+#include "MemoryAllocator.hpp"
+
+namespace FunnyOS::Misc::MemoryAllocator {
+
+    /**
+     * Type of an operation recorded in an allocation trace.
+     */
+    enum class AllocationTraceEvent : uint8_t { Allocate = 1, Free = 2, Reallocate = 3 };
+
+    /**
+     * A single operation recorded in an allocation trace. The layout is fixed, so traces recorded by the kernel or the
+     * bootloader can be read on any host.
+     */
+    struct AllocationTraceRecord {
+        /**
+         * Time of the operation, in units of the timestamp source of the tracer.
+         */
+        uint64_t Timestamp;
+
+        /**
+         * Address returned by Allocate or Reallocate (0 if they failed), or the address passed to Free.
+         */
+        uint64_t Address;
+
+        /**
+         * Address passed to Reallocate, 0 for other operations.
+         */
+        uint64_t PreviousAddress;
+
+        /**
+         * Requested size, saturated to 32 bits. 0 for Free.
+         */
+        uint32_t Size;
+
+        /**
+         * Type of the operation, one of AllocationTraceEvent.
+         */
+        AllocationTraceEvent Event;
+
+        /**
+         * Base 2 logarithm of the requested alignment.
+         */
+        uint8_t AlignmentShift;
+
+        /**
+         * Unused, always 0.
+         */
+        uint16_t Reserved;
+    };
+    static_assert(sizeof(AllocationTraceRecord) == 32, "Invalid AllocationTraceRecord size");
+
+    /**
+     * Header of a serialized allocation trace, followed by RecordCount AllocationTraceRecords, oldest first.
+     */
+    struct AllocationTraceHeader {
+        /**
+         * Always ALLOCATION_TRACE_MAGIC.
+         */
+        uint32_t Magic;
+
+        /**
+         * Always ALLOCATION_TRACE_VERSION.
+         */
+        uint32_t Version;
+
+        /**
+         * Amount of records that follow the header.
+         */
+        uint64_t RecordCount;
+
+        /**
+         * Amount of records that were overwritten in the ring buffer before the trace was serialized.
+         */
+        uint64_t DroppedRecordCount;
+    };
+    static_assert(sizeof(AllocationTraceHeader) == 24, "Invalid AllocationTraceHeader size");
+
+    /**
+     * Magic present at the beginning of every serialized allocation trace ("FATR").
+     */
+    constexpr const uint32_t ALLOCATION_TRACE_MAGIC = 0x52544146;
+
+    /**
+     * Version of the serialized allocation trace format.
+     */
+    constexpr const uint32_t ALLOCATION_TRACE_VERSION = 1;
+
+    /**
+     * An IMemoryAllocator that forwards all calls to another allocator and records every Allocate, Free and Reallocate
+     * in a ring buffer of AllocationTraceRecords.
+     *
+     * The ring buffer is provided by the user and never grows, when it is full the oldest records are overwritten. The
+     * recorded trace can be serialized and replayed on the host against other allocators.
+     */
+    class TracingMemoryAllocator : public IMemoryAllocator {
+       public:
+        /**
+         * Function returning the current timestamp.
+         */
+        using TimestampSource = uint64_t (*)();
+
+        /**
+         * Constructs a new tracing allocator.
+         *
+         * @param allocator allocator that performs the actual allocations
+         * @param buffer ring buffer for the records, must outlive the tracing allocator
+         * @param timestampSource source of the record timestamps, if nullptr the records are numbered instead
+         */
+        TracingMemoryAllocator(IMemoryAllocator& allocator,
+                               Stdlib::Memory::SizedBuffer<AllocationTraceRecord> buffer,
+                               TimestampSource timestampSource = nullptr) noexcept;
+
+        void* Allocate(size_t size, size_t alignment) noexcept override;
+
+        void Free(void* ptr) noexcept override;
+
+        void* Reallocate(void* ptr, size_t size, size_t alignment) noexcept override;
+
+        size_t GetTotalFreeMemory() const noexcept override;
+
+        size_t GetAllocatedMemory() const noexcept override;
+
+        size_t GetTotalAvailableMemory() const noexcept override;
+
+        /**
+         * Gets the amount of records currently held in the ring buffer.
+         *
+         * @return the amount of records
+         */
+        [[nodiscard]] size_t GetRecordCount() const noexcept;
+
+        /**
+         * Gets the amount of records that were overwritten because the ring buffer was full.
+         *
+         * @return the amount of overwritten records
+         */
+        [[nodiscard]] size_t GetDroppedRecordCount() const noexcept;
+
+        /**
+         * Gets a record from the ring buffer.
+         *
+         * @param index index of the record, 0 being the oldest record. Must be lower than GetRecordCount()
+         * @return the record
+         */
+        [[nodiscard]] const AllocationTraceRecord& GetRecord(size_t index) const noexcept;
+
+        /**
+         * Removes all records from the ring buffer.
+         */
+        void ClearRecords() noexcept;
+
+        /**
+         * Gets the amount of bytes needed to serialize the current trace.
+         *
+         * @return the size of the serialized trace
+         */
+        [[nodiscard]] size_t GetSerializedSize() const noexcept;
+
+        /**
+         * Serializes the current trace: an AllocationTraceHeader followed by all records, oldest first.
+         *
+         * @param output buffer to write the trace to, must be at least GetSerializedSize() bytes long
+         * @return the amount of bytes written
+         */
+        size_t Serialize(Stdlib::Memory::SizedBuffer<uint8_t>& output) const noexcept;
+
+       private:
+        /**
+         * Appends a record to the ring buffer, overwriting the oldest one if the buffer is full.
+         */
+        void Record(AllocationTraceEvent event, void* address, void* previousAddress, size_t size,
+                    size_t alignment) noexcept;
+
+       private:
+        IMemoryAllocator& m_allocator;
+        Stdlib::Memory::SizedBuffer<AllocationTraceRecord> m_buffer;
+        TimestampSource m_timestampSource;
+        uint64_t m_totalRecordCount;
+    };
+
+}  // namespace FunnyOS::Misc::MemoryAllocator
+
+#endif  // FUNNYOS_MISC_MEMORY_ALLOCATOR_HEADERS_FUNNYOS_MISC_MEMORYALLOCATOR_TRACINGMEMORYALLOCATOR_HPP
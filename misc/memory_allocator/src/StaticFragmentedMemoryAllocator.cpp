@@ -5,10 +5,22 @@
 namespace FunnyOS::Misc::MemoryAllocator {
     void StaticFragmentedMemoryAllocator::Initialize(
         const Stdlib::Memory::SizedBuffer<MemoryFragment>& memoryFragments) {
+        // Sort the fragments first, so the allocators can be binary searched
+        Stdlib::Vector<MemoryFragment> sortedFragments(memoryFragments.Size);
+
+        for (const auto& fragment : memoryFragments) {
+            size_t index = sortedFragments.Size();
+            while (index > 0 && sortedFragments[index - 1].RegionStart > fragment.RegionStart) {
+                index--;
+            }
+
+            sortedFragments.Insert(index, fragment);
+        }
+
         m_allocators.Clear();
         m_allocators.EnsureCapacity(memoryFragments.Size);
 
-        for (const auto& fragment : memoryFragments) {
+        for (const auto& fragment : sortedFragments) {
             StaticMemoryAllocator& newAllocator = m_allocators.AppendInPlace();
 
             newAllocator.Initialize(fragment.RegionStart, fragment.RegionEnd);
@@ -17,6 +29,10 @@ namespace FunnyOS::Misc::MemoryAllocator {
 
     void* StaticFragmentedMemoryAllocator::Allocate(size_t size, size_t alignment) noexcept {
         for (auto& allocator : m_allocators) {
+            if (allocator.GetLargestFreeBlockHint() < size) {
+                continue;
+            }
+
             void* memory = allocator.Allocate(size, alignment);
 
             if (memory != nullptr) {
@@ -28,28 +44,17 @@ namespace FunnyOS::Misc::MemoryAllocator {
     }
 
     void StaticFragmentedMemoryAllocator::Free(void* ptr) noexcept {
-        const auto address = reinterpret_cast<memoryaddress_t>(ptr);
+        StaticMemoryAllocator* allocator = FindAllocator(reinterpret_cast<memoryaddress_t>(ptr));
+        F_ASSERT_NOEXCEPT(allocator != nullptr, "no allocator for the given address");
 
-        for (auto& allocator : m_allocators) {
-            if (address >= allocator.GetMemoryStart() && address < allocator.GetMemoryEnd()) {
-                allocator.Free(ptr);
-                return;
-            }
-        }
-
-        F_FAIL_ASSERT("no allocator for the given address");
+        allocator->Free(ptr);
     }
 
     void* StaticFragmentedMemoryAllocator::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
-        const auto address = reinterpret_cast<memoryaddress_t>(ptr);
+        StaticMemoryAllocator* allocator = FindAllocator(reinterpret_cast<memoryaddress_t>(ptr));
+        F_ASSERT_NOEXCEPT(allocator != nullptr, "no allocator for the given address");
 
-        for (auto& allocator : m_allocators) {
-            if (address >= allocator.GetMemoryStart() && address < allocator.GetMemoryEnd()) {
-                return this->DoReallocate(allocator, ptr, size, alignment);
-            }
-        }
-
-        F_FAIL_ASSERT("no allocator for the given address");
+        return this->DoReallocate(*allocator, ptr, size, alignment);
     }
 
     namespace {
@@ -85,16 +90,47 @@ namespace FunnyOS::Misc::MemoryAllocator {
         return m_allocators;
     }
 
+    size_t StaticFragmentedMemoryAllocator::FindUpperBound(memoryaddress_t address) const noexcept {
+        size_t low  = 0;
+        size_t high = m_allocators.Size();
+
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+
+            if (m_allocators[middle].GetMemoryStart() <= address) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        return low;
+    }
+
+    StaticMemoryAllocator* StaticFragmentedMemoryAllocator::FindAllocator(memoryaddress_t address) noexcept {
+        const size_t index = FindUpperBound(address);
+        if (index == 0) {
+            return nullptr;
+        }
+
+        StaticMemoryAllocator& allocator = m_allocators[index - 1];
+        if (address >= allocator.GetMemoryEnd()) {
+            return nullptr;
+        }
+
+        return &allocator;
+    }
+
     void* StaticFragmentedMemoryAllocator::DoReallocate(
         StaticMemoryAllocator& alloc, void* ptr, size_t size, size_t alignment) {
 
-        // If the new block size is equal to the old block size there is no point in reallocating
-        const size_t oldBlockSize = alloc.GetMemoryBlockSize(ptr);
-
-        if (size == oldBlockSize) {
+        // Try to resize the block in its own fragment first
+        if (alloc.TryReallocateInPlace(ptr, size, alignment)) {
             return ptr;
         }
 
+        const size_t oldBlockSize = alloc.GetMemoryBlockSize(ptr);
+
         // Allocate new block
         void* newMemory = Allocate(size, alignment);
         if (newMemory == nullptr) {
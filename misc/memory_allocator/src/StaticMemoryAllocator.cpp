@@ -7,10 +7,6 @@
 namespace FunnyOS::Misc::MemoryAllocator {
     using namespace FunnyOS::Stdlib;
 
-    MemoryMetaBlock* MemoryMetaBlock::GetNext() const noexcept {
-        return reinterpret_cast<MemoryMetaBlock*>(NextFreeBlock);
-    }
-
     namespace {
         /**
          * Converts a pointer to  memoryaddress_t
@@ -64,33 +60,268 @@ namespace FunnyOS::Misc::MemoryAllocator {
             return AlignAddress(reinterpret_cast<memoryaddress_t>(memory), alignment);
         }
 
+        /**
+         * Links stored at the beginning of the memory of every Freed block.
+         */
+        struct FreeBlockLinks {
+            /**
+             * Next free block in the same size class or nullptr if this is the last one.
+             */
+            MemoryMetaBlock* NextInSizeClass;
+
+            /**
+             * Previous free block in the same size class or nullptr if this is the first one.
+             */
+            MemoryMetaBlock* PreviousInSizeClass;
+        };
+
+        /**
+         * Every block size is a multiple of this value, this keeps all block headers naturally aligned and leaves the
+         * lowest bits of MemoryMetaBlock::SizeAndFlags for the flags.
+         */
+        constexpr const size_t BLOCK_GRANULARITY = 8;
+
+        /**
+         * Minimum size of any block, a Freed block must be able to hold its FreeBlockLinks and its MemoryBoundaryTag.
+         */
+        constexpr const size_t MINIMUM_BLOCK_SIZE = sizeof(FreeBlockLinks) + sizeof(MemoryBoundaryTag);
+
+        /**
+         * Amount of bytes used by the allocator for every block.
+         */
+        constexpr const size_t BLOCK_OVERHEAD = sizeof(MemoryMetaBlock);
+
+        /**
+         * Flag set in MemoryMetaBlock::SizeAndFlags if the block is Freed.
+         */
+        constexpr const memoryaddress_t BLOCK_FREE_FLAG = 1 << 0;
+
+        /**
+         * Flag set in MemoryMetaBlock::SizeAndFlags if the block that directly precedes it in the memory is Freed.
+         */
+        constexpr const memoryaddress_t PREVIOUS_BLOCK_FREE_FLAG = 1 << 1;
+
+        /**
+         * Mask of all the flags in MemoryMetaBlock::SizeAndFlags.
+         */
+        constexpr const memoryaddress_t BLOCK_FLAGS_MASK = BLOCK_GRANULARITY - 1;
+
+        /**
+         * Blocks of sizes up to this value have a size class for every possible size.
+         */
+        constexpr const size_t EXACT_SIZE_CLASS_LIMIT = 256;
+
+        /**
+         * Amount of size classes that hold blocks of a single size.
+         */
+        constexpr const size_t EXACT_SIZE_CLASS_COUNT =
+            (EXACT_SIZE_CLASS_LIMIT - MINIMUM_BLOCK_SIZE) / BLOCK_GRANULARITY + 1;
+
+        /**
+         * Gets the size of the memory of the given block.
+         */
+        inline size_t GetBlockSize(const MemoryMetaBlock* block) {
+            return static_cast<size_t>(block->SizeAndFlags & ~BLOCK_FLAGS_MASK);
+        }
+
+        /**
+         * Checks whether the given block is Freed.
+         */
+        inline bool IsBlockFree(const MemoryMetaBlock* block) {
+            return (block->SizeAndFlags & BLOCK_FREE_FLAG) != 0;
+        }
+
+        /**
+         * Checks whether the block that directly precedes the given block in the memory is Freed.
+         */
+        inline bool IsPreviousBlockFree(const MemoryMetaBlock* block) {
+            return (block->SizeAndFlags & PREVIOUS_BLOCK_FREE_FLAG) != 0;
+        }
+
+        /**
+         * Verifies the status magic of the given block. Does nothing if the status magic is not present.
+         */
+        inline void CheckBlockStatus([[maybe_unused]] const MemoryMetaBlock* block) {
+#ifdef F_MEMORY_ALLOCATOR_STATUS_MAGIC
+            F_ASSERT_NOEXCEPT(
+                block->Status == (IsBlockFree(block) ? MemoryMetaStatus::Freed : MemoryMetaStatus::Taken),
+                "memory block corrupted");
+#endif
+        }
+
+        /**
+         * Sets up a header of a new block.
+         */
+        inline void InitializeBlock(MemoryMetaBlock* block, size_t size, bool free, bool previousFree) {
+            block->SizeAndFlags =
+                size | (free ? BLOCK_FREE_FLAG : 0) | (previousFree ? PREVIOUS_BLOCK_FREE_FLAG : 0);
+
+#ifdef F_MEMORY_ALLOCATOR_STATUS_MAGIC
+            block->Status = free ? MemoryMetaStatus::Freed : MemoryMetaStatus::Taken;
+#endif
+        }
+
+        /**
+         * Changes the size of the given block, keeping its flags.
+         */
+        inline void SetBlockSize(MemoryMetaBlock* block, size_t size) {
+            block->SizeAndFlags = size | (block->SizeAndFlags & BLOCK_FLAGS_MASK);
+        }
+
+        /**
+         * Changes the status of the given block.
+         */
+        inline void SetBlockFree(MemoryMetaBlock* block, bool free) {
+            InitializeBlock(block, GetBlockSize(block), free, IsPreviousBlockFree(block));
+        }
+
+        /**
+         * Sets or clears the PREVIOUS_BLOCK_FREE_FLAG of the given block, does nothing if [block] is nullptr.
+         */
+        inline void SetPreviousBlockFree(MemoryMetaBlock* block, bool previousFree) {
+            if (block == nullptr) {
+                return;
+            }
+
+            if (previousFree) {
+                block->SizeAndFlags |= PREVIOUS_BLOCK_FREE_FLAG;
+            } else {
+                block->SizeAndFlags &= ~PREVIOUS_BLOCK_FREE_FLAG;
+            }
+        }
+
+        /**
+         * Marks the header of a block that is no longer valid, so it is not mistaken for a block later.
+         */
+        inline void InvalidateBlock([[maybe_unused]] MemoryMetaBlock* block) {
+#ifdef F_MEMORY_ALLOCATOR_STATUS_MAGIC
+            block->Status = MemoryMetaStatus::Invalid;
+#endif
+        }
+
+        /**
+         * Gets the FreeBlockLinks of a Freed block.
+         */
+        inline FreeBlockLinks* GetFreeLinks(MemoryMetaBlock* block) {
+            return static_cast<FreeBlockLinks*>(GetBlockMemory(block));
+        }
+
+        /**
+         * Gets the address just after the memory of the given block, that is where the next block starts.
+         */
+        inline memoryaddress_t GetBlockEnd(MemoryMetaBlock* block) {
+            return PtrToAddress(GetBlockMemory(block)) + GetBlockSize(block);
+        }
+
+        /**
+         * Updates the boundary tag of the given Freed block to match its size.
+         */
+        inline void WriteBoundaryTag(MemoryMetaBlock* block) {
+            AddressToPtr<MemoryBoundaryTag>(GetBlockEnd(block) - sizeof(MemoryBoundaryTag))->BlockSize =
+                GetBlockSize(block);
+        }
+
+        /**
+         * Rounds a requested allocation size to a valid block size.
+         */
+        inline size_t RoundBlockSize(size_t size) {
+            if (size < MINIMUM_BLOCK_SIZE) {
+                return MINIMUM_BLOCK_SIZE;
+            }
+
+            return AlignAddress(size, BLOCK_GRANULARITY);
+        }
+
+        /**
+         * Gets the size class for a block of the given size.
+         *
+         * Sizes up to EXACT_SIZE_CLASS_LIMIT have a size class for every multiple of BLOCK_GRANULARITY, bigger sizes
+         * use one size class for every power of two.
+         */
+        inline size_t GetSizeClass(size_t size) {
+            if (size <= EXACT_SIZE_CLASS_LIMIT) {
+                return (size - MINIMUM_BLOCK_SIZE) / BLOCK_GRANULARITY;
+            }
+
+            const size_t log2      = 63 - F_COUNT_LEADING_ZEROS_64(size);
+            const size_t log2Limit = 63 - F_COUNT_LEADING_ZEROS_64(EXACT_SIZE_CLASS_LIMIT);
+            return Min(EXACT_SIZE_CLASS_COUNT + log2 - log2Limit, StaticMemoryAllocator::SIZE_CLASS_COUNT - 1);
+        }
+
+        /**
+         * Gets the biggest block size that can be present in the given size class.
+         */
+        inline size_t GetSizeClassLimit(size_t sizeClass) {
+            if (sizeClass < EXACT_SIZE_CLASS_COUNT) {
+                return MINIMUM_BLOCK_SIZE + sizeClass * BLOCK_GRANULARITY;
+            }
+
+            if (sizeClass == StaticMemoryAllocator::SIZE_CLASS_COUNT - 1) {
+                return ~static_cast<size_t>(0);
+            }
+
+            const size_t log2Limit = 63 - F_COUNT_LEADING_ZEROS_64(EXACT_SIZE_CLASS_LIMIT);
+            return (static_cast<size_t>(2) << (sizeClass - EXACT_SIZE_CLASS_COUNT + log2Limit)) - 1;
+        }
+
+        /**
+         * Checks whether every block in the given size class has the same size.
+         */
+        inline bool IsExactSizeClass(size_t sizeClass) {
+            return sizeClass < EXACT_SIZE_CLASS_COUNT;
+        }
+
+        /**
+         * Gets the first address inside the memory of the given block, at which a block with memory aligned to
+         * [alignment] can start. If the block memory is not aligned already, the memory before that address must be
+         * big enough to form a valid block.
+         */
+        inline memoryaddress_t GetAlignedBlockMemory(MemoryMetaBlock* block, size_t alignment) {
+            const memoryaddress_t blockMemory = PtrToAddress(GetBlockMemory(block));
+
+            if (IsAlignedTo(blockMemory, alignment)) {
+                return blockMemory;
+            }
+
+            return AlignAddress(blockMemory + BLOCK_OVERHEAD + MINIMUM_BLOCK_SIZE, alignment);
+        }
+
+        /**
+         * Checks whether a block of [size] bytes with memory aligned to [alignment] can be carved out of the given
+         * block.
+         */
+        inline bool CanHoldAlignedBlock(MemoryMetaBlock* block, size_t size, size_t alignment) {
+            const memoryaddress_t blockMemory = PtrToAddress(GetBlockMemory(block));
+            return GetAlignedBlockMemory(block, alignment) + size <= blockMemory + GetBlockSize(block);
+        }
+
     }  // namespace
 
     void StaticMemoryAllocator::Initialize(memoryaddress_t memoryStart, memoryaddress_t memoryEnd) noexcept {
+        memoryStart = AlignAddress(memoryStart, BLOCK_GRANULARITY);
+
         m_currentMemory = memoryStart;
         m_memoryStart   = memoryStart;
         m_memoryEnd     = memoryEnd;
         m_totalMemory   = memoryEnd - memoryStart;
         m_usedMemory    = 0;
 
-        m_firstFreeBlock = AddressToPtr<MemoryMetaBlock>(m_currentMemory);
-        m_lastFreeBlock  = m_firstFreeBlock;
-
-        m_firstFreeBlock->Status        = MemoryMetaStatus::Freed;
-        m_firstFreeBlock->BlockSize     = 0;
-        m_firstFreeBlock->NextFreeBlock = 0;
-
-        m_currentMemory += sizeof(MemoryMetaBlock);
-        m_usedMemory += sizeof(MemoryMetaBlock);
+        for (auto& sizeClass : m_sizeClasses) {
+            sizeClass = nullptr;
+        }
+        m_nonEmptySizeClasses = 0;
     }
 
     void* StaticMemoryAllocator::Allocate(size_t size, size_t alignment) noexcept {
+        size = RoundBlockSize(size);
+
         // Find a suitable free block
-        auto* freeBlockPredecessor = FindFreeBlockPredecessor(size, alignment);
+        auto* freeBlock = FindFreeBlock(size, alignment);
 
         // If found split it if possible, mark as taken and return.
-        if (freeBlockPredecessor != nullptr) {
-            MemoryMetaBlock* currentBlock = SplitBlockAndTakeItIfPossible(freeBlockPredecessor, size);
+        if (freeBlock != nullptr) {
+            freeBlock                     = SplitAlignedBlock(freeBlock, alignment);
+            MemoryMetaBlock* currentBlock = SplitBlockAndTakeItIfPossible(freeBlock, size);
             return GetBlockMemory(currentBlock);
         }
 
@@ -106,46 +337,53 @@ namespace FunnyOS::Misc::MemoryAllocator {
     void StaticMemoryAllocator::Free(void* ptr) noexcept {
         auto* block = GetMemoryBlock(ptr);
 
-        if (reinterpret_cast<uint64_t>(&block->Status) == 0x141b0) {
-            asm ("nop");
-        }
-
-        if (block->Status == MemoryMetaStatus::Freed) {
+        if (IsBlockFree(block)) {
             // whatever, maybe this should be reported?
             return;
         }
 
-        F_ASSERT(block->Status == MemoryMetaStatus::Taken, "Invalid block status");
+        CheckBlockStatus(block);
 
-        // Insert this block to free memory list, making sure that the memory stays sorted after the insert.
-        MemoryMetaBlock* blockToInsertAfter = m_firstFreeBlock;
-        while (blockToInsertAfter->NextFreeBlock != 0 && blockToInsertAfter->NextFreeBlock < PtrToAddress(block)) {
-            blockToInsertAfter = blockToInsertAfter->GetNext();
-        }
+        // Mark it as free
+        SetBlockFree(block, true);
 
-        block->NextFreeBlock              = blockToInsertAfter->NextFreeBlock;
-        blockToInsertAfter->NextFreeBlock = PtrToAddress(block);
+        // Update used memory
+        m_usedMemory -= GetBlockSize(block);
 
-        if (block->NextFreeBlock == 0) {
-            m_lastFreeBlock = block;
+        // Merge with the neighbouring blocks if they are free too
+        MemoryMetaBlock* nextBlock = GetNextBlock(block);
+        if (nextBlock != nullptr && IsBlockFree(nextBlock)) {
+            RemoveFromSizeClass(nextBlock);
+            MergeBlocks(block, nextBlock);
         }
 
-        // Mark it as free
-        block->Status = MemoryMetaStatus::Freed;
+        MemoryMetaBlock* previousBlock = GetPreviousFreeBlock(block);
+        if (previousBlock != nullptr) {
+            RemoveFromSizeClass(previousBlock);
+            MergeBlocks(previousBlock, block);
+            block = previousBlock;
+        }
 
-        // Update used memory
-        m_usedMemory -= block->BlockSize;
+        // If this is the top-most block, give it back to the unallocated memory
+        if (GetBlockEnd(block) == m_currentMemory) {
+            m_currentMemory = PtrToAddress(block);
+            m_usedMemory -= BLOCK_OVERHEAD;
+            InvalidateBlock(block);
+            return;
+        }
 
-        // If the free has created any Freed memory clumps we should try to merge them.
-        MergeMemory();
+        WriteBoundaryTag(block);
+        SetPreviousBlockFree(GetNextBlock(block), true);
+        InsertIntoSizeClass(block);
     }
 
     void* StaticMemoryAllocator::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
         auto* oldMemoryBlock = GetMemoryBlock(ptr);
-        F_ASSERT(oldMemoryBlock->Status == MemoryMetaStatus::Taken, "attempting to reallocate invalid block");
+        F_ASSERT_NOEXCEPT(!IsBlockFree(oldMemoryBlock), "attempting to reallocate invalid block");
+        CheckBlockStatus(oldMemoryBlock);
 
-        // If the new block size is equal to the old block size there is no point in reallocating
-        if (size == oldMemoryBlock->BlockSize) {
+        // Try to avoid copying the data first
+        if (TryReallocateInPlace(ptr, size, alignment)) {
             return ptr;
         }
 
@@ -156,13 +394,63 @@ namespace FunnyOS::Misc::MemoryAllocator {
         }
 
         // Copy data
-        Memory::Copy(newMemory, ptr, Min(static_cast<size_t>(oldMemoryBlock->BlockSize), size));
+        Memory::Copy(newMemory, ptr, Min(GetBlockSize(oldMemoryBlock), size));
 
         // Free old memory
         Free(ptr);
         return newMemory;
     }
 
+    bool StaticMemoryAllocator::TryReallocateInPlace(void* ptr, size_t size, size_t alignment) noexcept {
+        auto* block = GetMemoryBlock(ptr);
+        F_ASSERT_NOEXCEPT(!IsBlockFree(block), "attempting to reallocate invalid block");
+        CheckBlockStatus(block);
+
+        if (!IsAlignedTo(ptr, alignment)) {
+            return false;
+        }
+
+        size = RoundBlockSize(size);
+
+        // If the new block size is not bigger than the old block size there is no need to move the block
+        const size_t blockSize = GetBlockSize(block);
+        if (size <= blockSize) {
+            ShrinkBlock(block, size);
+            return true;
+        }
+
+        MemoryMetaBlock* nextBlock = GetNextBlock(block);
+
+        // The top-most block can just take more of the unallocated memory
+        if (nextBlock == nullptr) {
+            if (PtrToAddress(ptr) + size > m_memoryEnd) {
+                return false;
+            }
+
+            m_usedMemory += size - blockSize;
+            SetBlockSize(block, size);
+            m_currentMemory = GetBlockEnd(block);
+            return true;
+        }
+
+        // Otherwise take the following block if it is free and big enough
+        if (!IsBlockFree(nextBlock) || blockSize + BLOCK_OVERHEAD + GetBlockSize(nextBlock) < size) {
+            return false;
+        }
+
+        RemoveFromSizeClass(nextBlock);
+        InvalidateBlock(nextBlock);
+
+        // The overhead of the next block is now a part of this block
+        m_usedMemory += GetBlockSize(nextBlock);
+        SetBlockSize(block, blockSize + BLOCK_OVERHEAD + GetBlockSize(nextBlock));
+        SetPreviousBlockFree(GetNextBlock(block), false);
+
+        // Give back what was not needed
+        ShrinkBlock(block, size);
+        return true;
+    }
+
     size_t StaticMemoryAllocator::GetTotalFreeMemory() const noexcept {
         return m_totalMemory - m_usedMemory;
     }
@@ -176,7 +464,19 @@ namespace FunnyOS::Misc::MemoryAllocator {
     }
 
     size_t StaticMemoryAllocator::GetMemoryBlockSize(void* ptr) {
-        return static_cast<size_t>(GetMemoryBlock(ptr)->BlockSize);
+        return GetBlockSize(GetMemoryBlock(ptr));
+    }
+
+    size_t StaticMemoryAllocator::GetLargestFreeBlockHint() const noexcept {
+        const size_t unallocatedMemory = m_memoryEnd - m_currentMemory;
+        const size_t topBlockSize      = unallocatedMemory > BLOCK_OVERHEAD ? unallocatedMemory - BLOCK_OVERHEAD : 0;
+
+        if (m_nonEmptySizeClasses == 0) {
+            return topBlockSize;
+        }
+
+        const size_t highestSizeClass = 63 - F_COUNT_LEADING_ZEROS_64(m_nonEmptySizeClasses);
+        return Max(topBlockSize, GetSizeClassLimit(highestSizeClass));
     }
 
     memoryaddress_t StaticMemoryAllocator::GetCurrentMemoryTop() const noexcept {
@@ -191,107 +491,167 @@ namespace FunnyOS::Misc::MemoryAllocator {
         return m_memoryEnd;
     }
 
-    MemoryMetaBlock* StaticMemoryAllocator::FindFreeBlockPredecessor(size_t size, size_t alignment) noexcept {
-        MemoryMetaBlock* previousBlock;
-        MemoryMetaBlock* currentBlock = m_firstFreeBlock;
+    void StaticMemoryAllocator::SetMemoryEnd(memoryaddress_t memoryEnd) noexcept {
+        F_ASSERT_NOEXCEPT(memoryEnd >= m_currentMemory, "memory end below the current memory top");
 
-        while (currentBlock->NextFreeBlock != 0) {
-            previousBlock = currentBlock;
-            currentBlock  = AddressToPtr<MemoryMetaBlock>(currentBlock->NextFreeBlock);
+        m_totalMemory = m_totalMemory + memoryEnd - m_memoryEnd;
+        m_memoryEnd   = memoryEnd;
+    }
+
+    MemoryMetaBlock* StaticMemoryAllocator::FindFreeBlock(size_t size, size_t alignment) noexcept {
+        const size_t sizeClass = GetSizeClass(size);
+
+        // Every block in those size classes is big enough, even if its memory has to be aligned by splitting it.
+        const size_t worstCaseSize =
+            alignment <= BLOCK_GRANULARITY ? size : size + alignment + BLOCK_OVERHEAD + MINIMUM_BLOCK_SIZE;
+        const size_t worstCaseClass    = GetSizeClass(worstCaseSize);
+        const size_t firstFittingClass = IsExactSizeClass(worstCaseClass) ? worstCaseClass : worstCaseClass + 1;
+
+        const uint64_t fittingClasses =
+            firstFittingClass < SIZE_CLASS_COUNT ? m_nonEmptySizeClasses & (~0ULL << firstFittingClass) : 0;
+
+        if (fittingClasses != 0) {
+            MemoryMetaBlock* block = m_sizeClasses[F_COUNT_TRAILING_ZEROS_64(fittingClasses)];
 
             // Sanity check
-            F_ASSERT(currentBlock->Status == MemoryMetaStatus::Freed, "Non-freed block found in free block list");
+            F_ASSERT_NOEXCEPT(IsBlockFree(block), "Non-freed block found in free block list");
+            return block;
+        }
 
-            if (currentBlock->BlockSize < size) {
+        // Blocks in the size classes below may be too small, they have to be checked one by one.
+        const size_t lastCheckedClass = Min(firstFittingClass, SIZE_CLASS_COUNT);
+        for (size_t candidateClass = sizeClass; candidateClass < lastCheckedClass; candidateClass++) {
+            if ((m_nonEmptySizeClasses & (1ULL << candidateClass)) == 0) {
                 continue;
             }
 
-            if (!IsAlignedTo(GetBlockMemory(currentBlock), alignment)) {
-                continue;
-            }
+            for (MemoryMetaBlock* block = m_sizeClasses[candidateClass]; block != nullptr;
+                 block                  = GetFreeLinks(block)->NextInSizeClass) {
+                F_ASSERT_NOEXCEPT(IsBlockFree(block), "Non-freed block found in free block list");
 
-            // Found suitable block
-            return previousBlock;
+                if (CanHoldAlignedBlock(block, size, alignment)) {
+                    return block;
+                }
+            }
         }
 
         // No blocks found
         return nullptr;
     }
 
-    MemoryMetaBlock* StaticMemoryAllocator::SplitBlockAndTakeItIfPossible(
-        MemoryMetaBlock* predecessor, size_t size) noexcept {
-        F_ASSERT(predecessor->NextFreeBlock != 0, "predecessor has no actual next value");
+    MemoryMetaBlock* StaticMemoryAllocator::SplitAlignedBlock(MemoryMetaBlock* block, size_t alignment) noexcept {
+        F_ASSERT_NOEXCEPT(IsBlockFree(block), "aligning a non-freed block");
+
+        const memoryaddress_t blockMemory   = PtrToAddress(GetBlockMemory(block));
+        const memoryaddress_t alignedMemory = GetAlignedBlockMemory(block, alignment);
+
+        if (alignedMemory == blockMemory) {
+            return block;
+        }
+
+        RemoveFromSizeClass(block);
+
+        // Create the aligned block inside the free block
+        auto* alignedBlock = GetMemoryBlock(AddressToPtr<void>(alignedMemory));
+        InitializeBlock(alignedBlock, GetBlockSize(block) - (alignedMemory - blockMemory), true, true);
+        WriteBoundaryTag(alignedBlock);
+        InsertIntoSizeClass(alignedBlock);
+
+        // And give the leading remainder back to the free lists, the block before it is never free.
+        SetBlockSize(block, alignedMemory - blockMemory - BLOCK_OVERHEAD);
+        WriteBoundaryTag(block);
+        InsertIntoSizeClass(block);
+
+        m_usedMemory += BLOCK_OVERHEAD;
+        return alignedBlock;
+    }
+
+    MemoryMetaBlock* StaticMemoryAllocator::SplitBlockAndTakeItIfPossible(MemoryMetaBlock* block, size_t size) noexcept {
+        F_ASSERT_NOEXCEPT(IsBlockFree(block), "taking a non-freed block");
+        RemoveFromSizeClass(block);
 
-        auto* currentBlock = predecessor->GetNext();
-        if (currentBlock->BlockSize <= size + sizeof(MemoryMetaBlock)) {
-            // Block is too small, can't split, just mark it as taken and remove from the list.
-            predecessor->NextFreeBlock  = currentBlock->NextFreeBlock;
-            currentBlock->Status        = MemoryMetaStatus::Taken;
-            currentBlock->NextFreeBlock = 0;
+        const size_t blockSize = GetBlockSize(block);
+        if (blockSize < size + BLOCK_OVERHEAD + MINIMUM_BLOCK_SIZE) {
+            // Block is too small, can't split, just mark it as taken.
+            SetBlockFree(block, false);
+            SetPreviousBlockFree(GetNextBlock(block), false);
 
-            m_usedMemory += currentBlock->BlockSize;
-            return currentBlock;
+            m_usedMemory += blockSize;
+            return block;
         }
 
         // Create new MemoryMetaBlock struct after the first block.
-        auto* newFreeBlock =
-            reinterpret_cast<MemoryMetaBlock*>(reinterpret_cast<uint8_t*>(GetBlockMemory(currentBlock)) + size);
+        auto* newFreeBlock = AddressToPtr<MemoryMetaBlock>(PtrToAddress(GetBlockMemory(block)) + size);
 
-        // Setup MemoryMetaBlock for the second block.
-        newFreeBlock->Status        = MemoryMetaStatus::Freed;
-        newFreeBlock->BlockSize     = currentBlock->BlockSize - size - sizeof(MemoryMetaBlock);
-        newFreeBlock->NextFreeBlock = currentBlock->NextFreeBlock;
+        // Setup MemoryMetaBlock for the second block, the block after it already knows its predecessor is free.
+        InitializeBlock(newFreeBlock, blockSize - size - BLOCK_OVERHEAD, true, false);
+        WriteBoundaryTag(newFreeBlock);
+        InsertIntoSizeClass(newFreeBlock);
 
         // Setup MemoryMetaBlock for the first block
-        currentBlock->Status        = MemoryMetaStatus::Taken;
-        currentBlock->BlockSize     = size;
-        currentBlock->NextFreeBlock = 0;
+        SetBlockSize(block, size);
+        SetBlockFree(block, false);
 
-        m_usedMemory += currentBlock->BlockSize + sizeof(MemoryMetaBlock);
+        m_usedMemory += size + BLOCK_OVERHEAD;
+        return block;
+    }
 
-        // Update list
-        predecessor->NextFreeBlock = PtrToAddress(newFreeBlock);
+    void StaticMemoryAllocator::ShrinkBlock(MemoryMetaBlock* block, size_t size) noexcept {
+        F_ASSERT_NOEXCEPT(!IsBlockFree(block), "shrinking a non-taken block");
+        F_ASSERT_NOEXCEPT(size <= GetBlockSize(block), "shrinking to a bigger size");
 
-        return currentBlock;
+        const size_t blockSize = GetBlockSize(block);
+        if (blockSize < size + BLOCK_OVERHEAD + MINIMUM_BLOCK_SIZE) {
+            // Not enough memory to create a new block
+            return;
+        }
+
+        // Create a taken block from the remaining memory, the used memory stays the same.
+        auto* remainingBlock = AddressToPtr<MemoryMetaBlock>(PtrToAddress(GetBlockMemory(block)) + size);
+        InitializeBlock(remainingBlock, blockSize - size - BLOCK_OVERHEAD, false, false);
+        SetBlockSize(block, size);
+
+        // And free it, merging it with the next block or giving it back to the unallocated memory if possible.
+        Free(GetBlockMemory(remainingBlock));
     }
 
     MemoryMetaBlock* StaticMemoryAllocator::AllocateNewBlock(size_t size, size_t alignment) noexcept {
-        F_ASSERT(alignment > 0, "alignment == 0");
+        F_ASSERT_NOEXCEPT(alignment > 0, "alignment == 0");
 
-        // Create new memory block at the end of current memory
+        // Create new memory block at the end of current memory, the block below it is never free.
         auto* newMetaBlock = AddressToPtr<MemoryMetaBlock>(m_currentMemory);
+        bool previousFree  = false;
 
         if (!IsAlignedTo(GetBlockMemory(newMetaBlock), alignment)) {
-            memoryaddress_t newAlignedAddress = AlignAddress(GetBlockMemory(newMetaBlock), alignment);
+            const memoryaddress_t blockMemory = PtrToAddress(GetBlockMemory(newMetaBlock));
+            memoryaddress_t newAlignedAddress = AlignAddress(blockMemory, alignment);
+
+            // The aligning block must be able to hold its meta block and be a valid free block
+            while (newAlignedAddress - blockMemory < BLOCK_OVERHEAD + MINIMUM_BLOCK_SIZE) {
+                // Just skip to the next aligned address
+                newAlignedAddress += alignment;
+            }
 
             if (newAlignedAddress + size > m_memoryEnd) {
                 // out of memory
                 return nullptr;
             }
 
-            // As long as the aligning block is smaller than its meta block there is no point in creating in there
-            while (newAlignedAddress - PtrToAddress(GetBlockMemory(newMetaBlock)) <= sizeof(MemoryMetaBlock)) {
-                // Just skip to the next aligned address
-                newAlignedAddress += alignment;
-            }
+            // Create alignment block, there is nothing to merge it with.
+            InitializeBlock(newMetaBlock, newAlignedAddress - blockMemory - BLOCK_OVERHEAD, true, false);
+            WriteBoundaryTag(newMetaBlock);
+            InsertIntoSizeClass(newMetaBlock);
 
-            // Create alignment block
-            newMetaBlock->Status        = MemoryMetaStatus::Freed;
-            newMetaBlock->BlockSize     = newAlignedAddress - m_currentMemory - sizeof(MemoryMetaBlock) * 2;
-            newMetaBlock->NextFreeBlock = 0;
-
-            m_lastFreeBlock->NextFreeBlock = PtrToAddress(newMetaBlock);
-            m_lastFreeBlock                = newMetaBlock;
-            m_currentMemory += newMetaBlock->BlockSize + sizeof(MemoryMetaBlock);
+            m_currentMemory = GetBlockEnd(newMetaBlock);
+            m_usedMemory += BLOCK_OVERHEAD;
 
             // Update meta block
             newMetaBlock = AddressToPtr<MemoryMetaBlock>(m_currentMemory);
-
-            m_usedMemory += sizeof(MemoryMetaBlock);
+            previousFree = true;
         }
 
-        const memoryaddress_t lastByte = m_currentMemory + sizeof(MemoryMetaBlock) + size;
-        F_ASSERT(IsAlignedTo(GetBlockMemory(newMetaBlock), alignment), "alignment failed");
+        const memoryaddress_t lastByte = m_currentMemory + BLOCK_OVERHEAD + size;
+        F_ASSERT_NOEXCEPT(IsAlignedTo(GetBlockMemory(newMetaBlock), alignment), "alignment failed");
 
         if (lastByte > m_memoryEnd) {
             // Oops, we reached end of our memory space.
@@ -300,59 +660,85 @@ namespace FunnyOS::Misc::MemoryAllocator {
 
         // Increment current memory to be pointing just after the newMetaBlock
         m_currentMemory = lastByte;
-        m_usedMemory += sizeof(MemoryMetaBlock) + size;
+        m_usedMemory += BLOCK_OVERHEAD + size;
 
         // Setup the block and return.
-        newMetaBlock->Status        = MemoryMetaStatus::Taken;
-        newMetaBlock->BlockSize     = size;
-        newMetaBlock->NextFreeBlock = 0;
+        InitializeBlock(newMetaBlock, size, false, previousFree);
         return newMetaBlock;
     }
 
-    bool StaticMemoryAllocator::MergeMemory() noexcept {
-        MemoryMetaBlock* currentBlock = m_firstFreeBlock;
+    void StaticMemoryAllocator::InsertIntoSizeClass(MemoryMetaBlock* block) noexcept {
+        const size_t sizeClass = GetSizeClass(GetBlockSize(block));
+        MemoryMetaBlock* head  = m_sizeClasses[sizeClass];
 
-        // Never merge the first block, it is only a marker.
-        if (currentBlock->NextFreeBlock == 0) {
-            return false;
-        }
-        currentBlock = currentBlock->GetNext();
+        GetFreeLinks(block)->NextInSizeClass     = head;
+        GetFreeLinks(block)->PreviousInSizeClass = nullptr;
 
-        bool didMerge = false;
+        if (head != nullptr) {
+            GetFreeLinks(head)->PreviousInSizeClass = block;
+        }
 
-        // Iterate over all entries until the end of the list
-        while (currentBlock->NextFreeBlock != 0) {
-            const memoryaddress_t addressAfter = PtrToAddress(GetBlockMemory(currentBlock)) + currentBlock->BlockSize;
+        m_sizeClasses[sizeClass] = block;
+        m_nonEmptySizeClasses |= 1ULL << sizeClass;
+    }
 
-            // Sanity check, no valid function should ever do any operation on free memory list that would make it
-            // the list unsorted.
-            F_ASSERT(addressAfter > PtrToAddress(currentBlock), "free blocks not sorted");
+    void StaticMemoryAllocator::RemoveFromSizeClass(MemoryMetaBlock* block) noexcept {
+        const size_t sizeClass = GetSizeClass(GetBlockSize(block));
+        FreeBlockLinks* links  = GetFreeLinks(block);
 
-            // If the memory block ends exactly where the next free memory block is ...
-            if (currentBlock->NextFreeBlock != addressAfter) {
-                currentBlock = currentBlock->GetNext();
-                continue;
-            }
+        if (links->PreviousInSizeClass != nullptr) {
+            GetFreeLinks(links->PreviousInSizeClass)->NextInSizeClass = links->NextInSizeClass;
+        } else {
+            F_ASSERT_NOEXCEPT(m_sizeClasses[sizeClass] == block, "block not in its size class");
+            m_sizeClasses[sizeClass] = links->NextInSizeClass;
+        }
 
-            // ... we can merge them.
-            auto* nextBlock = currentBlock->GetNext();
-            F_ASSERT(currentBlock->Status == MemoryMetaStatus::Freed, "Non-freed block find in free block list");
-            F_ASSERT(nextBlock->Status == MemoryMetaStatus::Freed, "Non-freed block find in free block list");
+        if (links->NextInSizeClass != nullptr) {
+            GetFreeLinks(links->NextInSizeClass)->PreviousInSizeClass = links->PreviousInSizeClass;
+        }
 
-            // Update size of the now-merged memory block.
-            currentBlock->BlockSize += nextBlock->BlockSize + sizeof(MemoryMetaBlock);
+        if (m_sizeClasses[sizeClass] == nullptr) {
+            m_nonEmptySizeClasses &= ~(1ULL << sizeClass);
+        }
+    }
 
-            // Remove the second block from the list as it is no longer valid
-            currentBlock->NextFreeBlock = nextBlock->NextFreeBlock;
+    MemoryMetaBlock* StaticMemoryAllocator::GetNextBlock(MemoryMetaBlock* block) const noexcept {
+        const memoryaddress_t nextBlock = GetBlockEnd(block);
+        if (nextBlock >= m_currentMemory) {
+            return nullptr;
+        }
 
-            // One of the blocks is now gone, update used space
-            m_usedMemory -= sizeof(MemoryMetaBlock);
+        return AddressToPtr<MemoryMetaBlock>(nextBlock);
+    }
 
-            // Don't update currentBlock, process it one more time as more merges may possible for it
-            didMerge = true;
+    MemoryMetaBlock* StaticMemoryAllocator::GetPreviousFreeBlock(MemoryMetaBlock* block) const noexcept {
+        if (!IsPreviousBlockFree(block)) {
+            return nullptr;
         }
 
-        return didMerge;
+        const auto* tag = AddressToPtr<MemoryBoundaryTag>(PtrToAddress(block) - sizeof(MemoryBoundaryTag));
+        auto* previousBlock =
+            AddressToPtr<MemoryMetaBlock>(PtrToAddress(block) - tag->BlockSize - sizeof(MemoryMetaBlock));
+
+        // Sanity check
+        F_ASSERT_NOEXCEPT(
+            IsBlockFree(previousBlock) && GetBlockSize(previousBlock) == tag->BlockSize,
+            "boundary tag does not match the block");
+        CheckBlockStatus(previousBlock);
+        return previousBlock;
+    }
+
+    void StaticMemoryAllocator::MergeBlocks(MemoryMetaBlock* block, MemoryMetaBlock* nextBlock) noexcept {
+        F_ASSERT_NOEXCEPT(IsBlockFree(block), "Non-freed block merged");
+        F_ASSERT_NOEXCEPT(IsBlockFree(nextBlock), "Non-freed block merged");
+        F_ASSERT_NOEXCEPT(GetBlockEnd(block) == PtrToAddress(nextBlock), "merging non-adjacent blocks");
+
+        // The second block is now a part of the first one
+        InvalidateBlock(nextBlock);
+        SetBlockSize(block, GetBlockSize(block) + BLOCK_OVERHEAD + GetBlockSize(nextBlock));
+
+        // One of the blocks is now gone, update used space
+        m_usedMemory -= BLOCK_OVERHEAD;
     }
 
-}  // namespace FunnyOS::Misc::MemoryAllocator
\ No newline at end of file
+}  // namespace FunnyOS::Misc::MemoryAllocator
@@ -0,0 +1,115 @@
+#include <FunnyOS/Misc/MemoryAllocator/TracingMemoryAllocator.hpp>
+
+#include <FunnyOS/Stdlib/Algorithm.hpp>
+
+namespace FunnyOS::Misc::MemoryAllocator {
+    namespace {
+        inline uint8_t GetAlignmentShift(size_t alignment) {
+            uint8_t shift = 0;
+
+            while ((static_cast<size_t>(1) << (shift + 1)) <= alignment) {
+                shift++;
+            }
+
+            return shift;
+        }
+
+        inline uint64_t AddressToInteger(void* address) {
+            return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
+        }
+    }  // namespace
+
+    TracingMemoryAllocator::TracingMemoryAllocator(IMemoryAllocator& allocator,
+                                                   Stdlib::Memory::SizedBuffer<AllocationTraceRecord> buffer,
+                                                   TimestampSource timestampSource) noexcept
+        : m_allocator(allocator), m_buffer(buffer), m_timestampSource(timestampSource), m_totalRecordCount(0) {}
+
+    void* TracingMemoryAllocator::Allocate(size_t size, size_t alignment) noexcept {
+        void* memory = m_allocator.Allocate(size, alignment);
+        Record(AllocationTraceEvent::Allocate, memory, nullptr, size, alignment);
+        return memory;
+    }
+
+    void TracingMemoryAllocator::Free(void* ptr) noexcept {
+        Record(AllocationTraceEvent::Free, ptr, nullptr, 0, 1);
+        m_allocator.Free(ptr);
+    }
+
+    void* TracingMemoryAllocator::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
+        void* memory = m_allocator.Reallocate(ptr, size, alignment);
+        Record(AllocationTraceEvent::Reallocate, memory, ptr, size, alignment);
+        return memory;
+    }
+
+    size_t TracingMemoryAllocator::GetTotalFreeMemory() const noexcept {
+        return m_allocator.GetTotalFreeMemory();
+    }
+
+    size_t TracingMemoryAllocator::GetAllocatedMemory() const noexcept {
+        return m_allocator.GetAllocatedMemory();
+    }
+
+    size_t TracingMemoryAllocator::GetTotalAvailableMemory() const noexcept {
+        return m_allocator.GetTotalAvailableMemory();
+    }
+
+    size_t TracingMemoryAllocator::GetRecordCount() const noexcept {
+        return static_cast<size_t>(Stdlib::Min<uint64_t>(m_totalRecordCount, m_buffer.Size));
+    }
+
+    size_t TracingMemoryAllocator::GetDroppedRecordCount() const noexcept {
+        return static_cast<size_t>(m_totalRecordCount - GetRecordCount());
+    }
+
+    const AllocationTraceRecord& TracingMemoryAllocator::GetRecord(size_t index) const noexcept {
+        F_ASSERT_NOEXCEPT(index < GetRecordCount(), "record index out of bounds");
+
+        // The oldest record is the one that will be overwritten next
+        const size_t oldest = static_cast<size_t>(m_totalRecordCount - GetRecordCount()) % m_buffer.Size;
+        return m_buffer.Data[(oldest + index) % m_buffer.Size];
+    }
+
+    void TracingMemoryAllocator::ClearRecords() noexcept {
+        m_totalRecordCount = 0;
+    }
+
+    size_t TracingMemoryAllocator::GetSerializedSize() const noexcept {
+        return sizeof(AllocationTraceHeader) + GetRecordCount() * sizeof(AllocationTraceRecord);
+    }
+
+    size_t TracingMemoryAllocator::Serialize(Stdlib::Memory::SizedBuffer<uint8_t>& output) const noexcept {
+        F_ASSERT_NOEXCEPT(output.Size >= GetSerializedSize(), "output buffer too small");
+
+        const AllocationTraceHeader header = {ALLOCATION_TRACE_MAGIC, ALLOCATION_TRACE_VERSION, GetRecordCount(),
+                                              GetDroppedRecordCount()};
+        Stdlib::Memory::Copy(output.Data, &header, sizeof(header));
+
+        uint8_t* current = output.Data + sizeof(header);
+        for (size_t i = 0; i < GetRecordCount(); i++) {
+            Stdlib::Memory::Copy(current, &GetRecord(i), sizeof(AllocationTraceRecord));
+            current += sizeof(AllocationTraceRecord);
+        }
+
+        return GetSerializedSize();
+    }
+
+    void TracingMemoryAllocator::Record(
+        AllocationTraceEvent event, void* address, void* previousAddress, size_t size, size_t alignment) noexcept {
+        if (m_buffer.Size == 0) {
+            return;
+        }
+
+        AllocationTraceRecord& record = m_buffer.Data[m_totalRecordCount % m_buffer.Size];
+
+        record.Timestamp       = m_timestampSource != nullptr ? m_timestampSource() : m_totalRecordCount;
+        record.Address         = AddressToInteger(address);
+        record.PreviousAddress = AddressToInteger(previousAddress);
+        record.Size            = static_cast<uint32_t>(Stdlib::Min<uint64_t>(size, 0xFFFFFFFF));
+        record.Event           = event;
+        record.AlignmentShift  = GetAlignmentShift(alignment);
+        record.Reserved        = 0;
+
+        m_totalRecordCount++;
+    }
+
+}  // namespace FunnyOS::Misc::MemoryAllocator
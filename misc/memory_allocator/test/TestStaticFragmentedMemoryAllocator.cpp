@@ -0,0 +1,93 @@
+#include "Common.hpp"
+#include <FunnyOS/Misc/MemoryAllocator/StaticFragmentedMemoryAllocator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Misc::MemoryAllocator;
+
+namespace {
+    constexpr const size_t SMALL_FRAGMENT_SIZE = 4096;
+    constexpr const size_t BIG_FRAGMENT_SIZE   = 64 * 1024;
+
+    class TestStaticFragmentedMemoryAllocator : public ::testing::Test {
+       protected:
+        void SetUp() override {
+            MemoryFragment fragments[] = {
+                FragmentOf(m_big, BIG_FRAGMENT_SIZE), FragmentOf(m_small[1], SMALL_FRAGMENT_SIZE),
+                FragmentOf(m_small[0], SMALL_FRAGMENT_SIZE)};
+
+            m_allocator.Initialize(FunnyOS::Stdlib::Memory::SizedBuffer<MemoryFragment>{fragments, 3});
+        }
+
+        static MemoryFragment FragmentOf(uint8_t* memory, size_t size) {
+            const auto start = reinterpret_cast<memoryaddress_t>(memory);
+            return MemoryFragment{start, start + size};
+        }
+
+        static bool IsIn(void* ptr, uint8_t* memory, size_t size) {
+            return ptr >= memory && ptr < memory + size;
+        }
+
+        alignas(4096) uint8_t m_small[2][SMALL_FRAGMENT_SIZE];
+        alignas(4096) uint8_t m_big[BIG_FRAGMENT_SIZE];
+        StaticFragmentedMemoryAllocator m_allocator;
+    };
+}  // namespace
+
+TEST_F(TestStaticFragmentedMemoryAllocator, TestMemberAllocatorsAreSorted) {
+    const auto& allocators = m_allocator.GetMemberAllocators();
+    ASSERT_EQ(3, allocators.Size());
+
+    for (size_t i = 1; i < allocators.Size(); i++) {
+        EXPECT_LT(allocators[i - 1].GetMemoryStart(), allocators[i].GetMemoryStart());
+    }
+}
+
+TEST_F(TestStaticFragmentedMemoryAllocator, TestFreeUsesOwningFragment) {
+    void* pointers[64];
+
+    for (auto& pointer : pointers) {
+        pointer = m_allocator.Allocate(200, 8);
+        ASSERT_NE(nullptr, pointer);
+    }
+
+    for (auto* pointer : pointers) {
+        m_allocator.Free(pointer);
+    }
+
+    EXPECT_EQ(0, m_allocator.GetAllocatedMemory());
+}
+
+TEST_F(TestStaticFragmentedMemoryAllocator, TestBigAllocationSkipsSmallFragments) {
+    void* memory = m_allocator.Allocate(SMALL_FRAGMENT_SIZE * 2, 8);
+
+    ASSERT_NE(nullptr, memory);
+    EXPECT_TRUE(IsIn(memory, m_big, BIG_FRAGMENT_SIZE));
+    EXPECT_EQ(nullptr, m_allocator.Allocate(BIG_FRAGMENT_SIZE, 8));
+}
+
+TEST_F(TestStaticFragmentedMemoryAllocator, TestReallocateMovesBetweenFragments) {
+    auto* memory = static_cast<uint8_t*>(m_allocator.Allocate(64, 8));
+    ASSERT_TRUE(IsIn(memory, m_small[0], SMALL_FRAGMENT_SIZE));
+    memory[0] = 42;
+
+    memory = static_cast<uint8_t*>(m_allocator.Reallocate(memory, SMALL_FRAGMENT_SIZE * 2, 8));
+    ASSERT_NE(nullptr, memory);
+    EXPECT_TRUE(IsIn(memory, m_big, BIG_FRAGMENT_SIZE));
+    EXPECT_EQ(42, memory[0]);
+}
+
+TEST(TestStaticMemoryAllocatorHint, TestLargestFreeBlockHint) {
+    alignas(4096) static uint8_t heap[BIG_FRAGMENT_SIZE];
+    StaticMemoryAllocator allocator;
+    allocator.Initialize(reinterpret_cast<memoryaddress_t>(heap), reinterpret_cast<memoryaddress_t>(heap) + 8192);
+
+    void* big = allocator.Allocate(4000, 8);
+    allocator.Allocate(4000, 8);
+    EXPECT_LT(allocator.GetLargestFreeBlockHint(), 4000);
+    EXPECT_EQ(nullptr, allocator.Allocate(4000, 8));
+
+    allocator.Free(big);
+    EXPECT_GE(allocator.GetLargestFreeBlockHint(), 4000);
+    EXPECT_EQ(big, allocator.Allocate(4000, 8));
+}
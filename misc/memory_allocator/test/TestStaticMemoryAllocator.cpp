@@ -0,0 +1,312 @@
+#include "Common.hpp"
+#include <FunnyOS/Misc/MemoryAllocator/StaticMemoryAllocator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Misc::MemoryAllocator;
+
+namespace {
+    constexpr const size_t HEAP_SIZE = 1024 * 1024;
+
+    class TestStaticMemoryAllocator : public ::testing::Test {
+       protected:
+        void SetUp() override {
+            m_allocator.Initialize(
+                reinterpret_cast<memoryaddress_t>(m_heap), reinterpret_cast<memoryaddress_t>(m_heap) + HEAP_SIZE);
+        }
+
+        alignas(4096) uint8_t m_heap[HEAP_SIZE];
+        StaticMemoryAllocator m_allocator;
+    };
+
+    bool IsAligned(void* ptr, size_t alignment) {
+        return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+    }
+}  // namespace
+
+TEST_F(TestStaticMemoryAllocator, TestAllocateAndFree) {
+    void* first  = m_allocator.Allocate(16, 8);
+    void* second = m_allocator.Allocate(100, 8);
+
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+    EXPECT_GE(m_allocator.GetMemoryBlockSize(first), 16);
+    EXPECT_GE(m_allocator.GetMemoryBlockSize(second), 100);
+
+    m_allocator.Free(first);
+    m_allocator.Free(second);
+}
+
+TEST_F(TestStaticMemoryAllocator, TestFreedBlockIsReused) {
+    void* first = m_allocator.Allocate(64, 8);
+    m_allocator.Allocate(64, 8);
+
+    m_allocator.Free(first);
+    EXPECT_EQ(first, m_allocator.Allocate(64, 8));
+}
+
+TEST_F(TestStaticMemoryAllocator, TestBiggerFreeBlockIsSplit) {
+    void* big = m_allocator.Allocate(4096, 8);
+    m_allocator.Allocate(16, 8);
+    m_allocator.Free(big);
+
+    const memoryaddress_t top = m_allocator.GetCurrentMemoryTop();
+    void* first               = m_allocator.Allocate(1000, 8);
+    void* second              = m_allocator.Allocate(1000, 8);
+
+    EXPECT_EQ(big, first);
+    EXPECT_GT(reinterpret_cast<uintptr_t>(second), reinterpret_cast<uintptr_t>(first));
+    EXPECT_LT(reinterpret_cast<uintptr_t>(second), reinterpret_cast<uintptr_t>(big) + 4096);
+    EXPECT_EQ(top, m_allocator.GetCurrentMemoryTop());
+}
+
+TEST_F(TestStaticMemoryAllocator, TestAdjacentFreeBlocksAreMerged) {
+    void* blocks[8];
+    for (auto& block : blocks) {
+        block = m_allocator.Allocate(256, 8);
+    }
+    m_allocator.Allocate(16, 8);
+
+    // Free in an order that requires merging with both neighbours
+    for (size_t i = 0; i < 8; i += 2) {
+        m_allocator.Free(blocks[i]);
+    }
+    for (size_t i = 1; i < 8; i += 2) {
+        m_allocator.Free(blocks[i]);
+    }
+
+    const memoryaddress_t top = m_allocator.GetCurrentMemoryTop();
+    EXPECT_EQ(blocks[0], m_allocator.Allocate(8 * 256, 8));
+    EXPECT_EQ(top, m_allocator.GetCurrentMemoryTop());
+}
+
+TEST_F(TestStaticMemoryAllocator, TestFreeingTopBlocksShrinksHeap) {
+    void* first  = m_allocator.Allocate(128, 8);
+    void* second = m_allocator.Allocate(128, 8);
+    void* third  = m_allocator.Allocate(128, 8);
+
+    const memoryaddress_t top = m_allocator.GetCurrentMemoryTop();
+    m_allocator.Free(second);
+    EXPECT_EQ(top, m_allocator.GetCurrentMemoryTop());
+
+    // Freeing the top block merges it with the free block below it and gives both back
+    m_allocator.Free(third);
+    EXPECT_LT(m_allocator.GetCurrentMemoryTop(), reinterpret_cast<memoryaddress_t>(second));
+
+    m_allocator.Free(first);
+    EXPECT_EQ(m_allocator.GetMemoryStart(), m_allocator.GetCurrentMemoryTop());
+    EXPECT_EQ(0, m_allocator.GetAllocatedMemory());
+}
+
+TEST_F(TestStaticMemoryAllocator, TestSmallBlocksAreCompact) {
+    constexpr const size_t OBJECTS = 100;
+
+    for (size_t i = 0; i < OBJECTS; i++) {
+        ASSERT_NE(nullptr, m_allocator.Allocate(24, 8));
+    }
+
+    const memoryaddress_t heapSize = m_allocator.GetCurrentMemoryTop() - m_allocator.GetMemoryStart();
+    EXPECT_EQ(OBJECTS * (24 + sizeof(MemoryMetaBlock)), heapSize);
+    EXPECT_EQ(heapSize, m_allocator.GetAllocatedMemory());
+
+#ifndef F_MEMORY_ALLOCATOR_STATUS_MAGIC
+    EXPECT_EQ(8, sizeof(MemoryMetaBlock));
+#endif
+}
+
+TEST_F(TestStaticMemoryAllocator, TestAlignment) {
+    m_allocator.Allocate(24, 8);
+
+    for (size_t alignment = 8; alignment <= 4096; alignment *= 2) {
+        void* memory = m_allocator.Allocate(40, alignment);
+
+        ASSERT_NE(nullptr, memory);
+        EXPECT_TRUE(IsAligned(memory, alignment));
+    }
+}
+
+TEST_F(TestStaticMemoryAllocator, TestAlignedBlockIsCarvedFromFreeBlock) {
+    auto* big = static_cast<uint8_t*>(m_allocator.Allocate(8192, 8));
+    m_allocator.Allocate(16, 8);
+    m_allocator.Free(big);
+
+    const memoryaddress_t top = m_allocator.GetCurrentMemoryTop();
+    auto* aligned             = static_cast<uint8_t*>(m_allocator.Allocate(256, 4096));
+    auto* remainder           = static_cast<uint8_t*>(m_allocator.Allocate(16, 8));
+
+    ASSERT_NE(nullptr, aligned);
+    EXPECT_TRUE(IsAligned(aligned, 4096));
+    EXPECT_GE(aligned, big);
+    EXPECT_LE(aligned + 256, big + 8192);
+    EXPECT_GE(remainder, big);
+    EXPECT_LT(remainder, big + 8192);
+    EXPECT_EQ(top, m_allocator.GetCurrentMemoryTop());
+}
+
+TEST_F(TestStaticMemoryAllocator, TestAlignedAllocationsFragmentation) {
+    constexpr const size_t ROUNDS  = 100;
+    constexpr const size_t OBJECTS = 32;
+    void* objects[OBJECTS];
+
+    // Every round frees its aligned objects, but a small block allocated after them keeps them below the heap top.
+    for (size_t round = 0; round < ROUNDS; round++) {
+        for (auto& object : objects) {
+            object = m_allocator.Allocate(48 + round % 5 * 8, 64 << (round % 3));
+            ASSERT_NE(nullptr, object);
+        }
+
+        m_allocator.Allocate(16, 8);
+
+        for (auto* object : objects) {
+            m_allocator.Free(object);
+        }
+    }
+
+    const memoryaddress_t heapGrowth = m_allocator.GetCurrentMemoryTop() - m_allocator.GetMemoryStart();
+    RecordProperty("HeapGrowth", static_cast<int>(heapGrowth));
+    RecordProperty("FreeMemoryInHeap", static_cast<int>(heapGrowth - m_allocator.GetAllocatedMemory()));
+
+    // Without reusing the freed memory the heap would grow by at least ROUNDS * OBJECTS * 64 bytes.
+    EXPECT_LT(heapGrowth, OBJECTS * 512 + ROUNDS * 64);
+}
+
+TEST_F(TestStaticMemoryAllocator, TestOutOfMemory) {
+    EXPECT_EQ(nullptr, m_allocator.Allocate(HEAP_SIZE, 8));
+    EXPECT_NE(nullptr, m_allocator.Allocate(HEAP_SIZE / 2, 8));
+}
+
+TEST_F(TestStaticMemoryAllocator, TestMovingMemoryEnd) {
+    const memoryaddress_t start = reinterpret_cast<memoryaddress_t>(m_heap);
+    m_allocator.Initialize(start, start + HEAP_SIZE / 4);
+
+    EXPECT_EQ(nullptr, m_allocator.Allocate(HEAP_SIZE / 2, 8));
+
+    m_allocator.SetMemoryEnd(start + HEAP_SIZE);
+    EXPECT_EQ(HEAP_SIZE, m_allocator.GetTotalAvailableMemory());
+
+    void* memory = m_allocator.Allocate(HEAP_SIZE / 2, 8);
+    ASSERT_NE(nullptr, memory);
+
+    m_allocator.Free(memory);
+    m_allocator.SetMemoryEnd(start + HEAP_SIZE / 4);
+    EXPECT_EQ(HEAP_SIZE / 4, m_allocator.GetTotalAvailableMemory());
+    EXPECT_EQ(HEAP_SIZE / 4, m_allocator.GetTotalFreeMemory());
+}
+
+TEST_F(TestStaticMemoryAllocator, TestReallocatePreservesData) {
+    auto* memory = static_cast<uint8_t*>(m_allocator.Allocate(32, 8));
+    for (uint8_t i = 0; i < 32; i++) {
+        memory[i] = i;
+    }
+
+    memory = static_cast<uint8_t*>(m_allocator.Reallocate(memory, 4096, 8));
+    ASSERT_NE(nullptr, memory);
+
+    for (uint8_t i = 0; i < 32; i++) {
+        EXPECT_EQ(i, memory[i]);
+    }
+}
+
+TEST_F(TestStaticMemoryAllocator, TestReallocateTopBlockInPlace) {
+    m_allocator.Allocate(64, 8);
+    void* memory = m_allocator.Allocate(64, 8);
+
+    EXPECT_EQ(memory, m_allocator.Reallocate(memory, 8192, 8));
+    EXPECT_GE(m_allocator.GetMemoryBlockSize(memory), 8192);
+}
+
+TEST_F(TestStaticMemoryAllocator, TestReallocateIntoFreeSuccessor) {
+    void* memory = m_allocator.Allocate(64, 8);
+    void* next   = m_allocator.Allocate(512, 8);
+    m_allocator.Allocate(64, 8);
+    m_allocator.Free(next);
+
+    EXPECT_EQ(memory, m_allocator.Reallocate(memory, 256, 8));
+
+    // The rest of the free successor is still available
+    void* rest = m_allocator.Allocate(128, 8);
+    EXPECT_GT(reinterpret_cast<uintptr_t>(rest), reinterpret_cast<uintptr_t>(memory));
+    EXPECT_LT(reinterpret_cast<uintptr_t>(rest), reinterpret_cast<uintptr_t>(next) + 512);
+}
+
+TEST_F(TestStaticMemoryAllocator, TestReallocateShrinksInPlace) {
+    void* memory = m_allocator.Allocate(1024, 8);
+    m_allocator.Allocate(64, 8);
+
+    EXPECT_EQ(memory, m_allocator.Reallocate(memory, 128, 8));
+    EXPECT_LT(m_allocator.GetMemoryBlockSize(memory), 1024);
+
+    void* reused = m_allocator.Allocate(512, 8);
+    EXPECT_GT(reinterpret_cast<uintptr_t>(reused), reinterpret_cast<uintptr_t>(memory));
+    EXPECT_LT(reinterpret_cast<uintptr_t>(reused), reinterpret_cast<uintptr_t>(memory) + 1024);
+}
+
+TEST_F(TestStaticMemoryAllocator, TestReallocateMovesWhenBlocked) {
+    void* memory = m_allocator.Allocate(64, 8);
+    m_allocator.Allocate(64, 8);
+
+    EXPECT_NE(memory, m_allocator.Reallocate(memory, 256, 8));
+}
+
+TEST_F(TestStaticMemoryAllocator, TestStress) {
+    constexpr const size_t SLOTS = 256;
+    uint8_t* slots[SLOTS]        = {nullptr};
+    size_t sizes[SLOTS]          = {0};
+    uint32_t seed                = 12345;
+
+    auto random = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    for (size_t iteration = 0; iteration < 20000; iteration++) {
+        const size_t slot = random() % SLOTS;
+
+        if (slots[slot] != nullptr && random() % 4 == 0) {
+            const size_t newSize = 1 + random() % 512;
+            slots[slot]          = static_cast<uint8_t*>(m_allocator.Reallocate(slots[slot], newSize, 8));
+            ASSERT_NE(nullptr, slots[slot]);
+
+            for (size_t i = 0; i < newSize; i++) {
+                if (i < sizes[slot]) {
+                    ASSERT_EQ(static_cast<uint8_t>(slot), slots[slot][i]);
+                }
+                slots[slot][i] = static_cast<uint8_t>(slot);
+            }
+
+            sizes[slot] = newSize;
+            continue;
+        }
+
+        if (slots[slot] != nullptr) {
+            for (size_t i = 0; i < sizes[slot]; i++) {
+                ASSERT_EQ(static_cast<uint8_t>(slot), slots[slot][i]);
+            }
+
+            m_allocator.Free(slots[slot]);
+            slots[slot] = nullptr;
+            continue;
+        }
+
+        sizes[slot] = 1 + random() % (random() % 8 == 0 ? 2048 : 128);
+        slots[slot] = static_cast<uint8_t*>(m_allocator.Allocate(sizes[slot], random() % 16 == 0 ? 64 : 8));
+        ASSERT_NE(nullptr, slots[slot]);
+
+        for (size_t i = 0; i < sizes[slot]; i++) {
+            slots[slot][i] = static_cast<uint8_t>(slot);
+        }
+    }
+
+    for (auto* slot : slots) {
+        if (slot != nullptr) {
+            m_allocator.Free(slot);
+        }
+    }
+
+    // Everything was merged back, the whole used memory can be allocated as one block without growing
+    const memoryaddress_t top = m_allocator.GetCurrentMemoryTop();
+    const size_t usedSize     = top - m_allocator.GetMemoryStart();
+    EXPECT_NE(nullptr, m_allocator.Allocate(usedSize - 64, 8));
+    EXPECT_LE(m_allocator.GetCurrentMemoryTop(), top);
+}
@@ -0,0 +1,112 @@
+#include "Common.hpp"
+#include <FunnyOS/Misc/MemoryAllocator/StaticMemoryAllocator.hpp>
+#include <FunnyOS/Misc/MemoryAllocator/TracingMemoryAllocator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Misc::MemoryAllocator;
+using FunnyOS::Stdlib::Memory::SizedBuffer;
+
+namespace {
+    constexpr const size_t HEAP_SIZE = 64 * 1024;
+
+    class TestTracingMemoryAllocator : public ::testing::Test {
+       protected:
+        void SetUp() override {
+            const auto start = reinterpret_cast<memoryaddress_t>(m_memory);
+            m_heap.Initialize(start, start + HEAP_SIZE);
+        }
+
+        static uint64_t AddressOf(void* ptr) {
+            return reinterpret_cast<uintptr_t>(ptr);
+        }
+
+        alignas(4096) uint8_t m_memory[HEAP_SIZE];
+        StaticMemoryAllocator m_heap;
+        AllocationTraceRecord m_records[4];
+    };
+}  // namespace
+
+TEST_F(TestTracingMemoryAllocator, TestOperationsAreRecorded) {
+    TracingMemoryAllocator tracer{m_heap, SizedBuffer<AllocationTraceRecord>{m_records, 4}};
+
+    void* memory = tracer.Allocate(100, 64);
+    ASSERT_NE(nullptr, memory);
+    EXPECT_EQ(m_heap.GetAllocatedMemory(), tracer.GetAllocatedMemory());
+
+    void* reallocated = tracer.Reallocate(memory, 300, 8);
+    ASSERT_NE(nullptr, reallocated);
+    tracer.Free(reallocated);
+
+    ASSERT_EQ(3, tracer.GetRecordCount());
+    EXPECT_EQ(0, tracer.GetDroppedRecordCount());
+
+    const AllocationTraceRecord& allocate = tracer.GetRecord(0);
+    EXPECT_EQ(AllocationTraceEvent::Allocate, allocate.Event);
+    EXPECT_EQ(AddressOf(memory), allocate.Address);
+    EXPECT_EQ(100, allocate.Size);
+    EXPECT_EQ(6, allocate.AlignmentShift);
+
+    const AllocationTraceRecord& reallocate = tracer.GetRecord(1);
+    EXPECT_EQ(AllocationTraceEvent::Reallocate, reallocate.Event);
+    EXPECT_EQ(AddressOf(reallocated), reallocate.Address);
+    EXPECT_EQ(AddressOf(memory), reallocate.PreviousAddress);
+    EXPECT_EQ(300, reallocate.Size);
+    EXPECT_EQ(3, reallocate.AlignmentShift);
+
+    const AllocationTraceRecord& free = tracer.GetRecord(2);
+    EXPECT_EQ(AllocationTraceEvent::Free, free.Event);
+    EXPECT_EQ(AddressOf(reallocated), free.Address);
+
+    // Without a timestamp source the records are numbered
+    EXPECT_EQ(0, allocate.Timestamp);
+    EXPECT_EQ(1, reallocate.Timestamp);
+    EXPECT_EQ(2, free.Timestamp);
+}
+
+TEST_F(TestTracingMemoryAllocator, TestRingBufferOverwritesOldestRecords) {
+    TracingMemoryAllocator tracer{m_heap, SizedBuffer<AllocationTraceRecord>{m_records, 4}};
+
+    for (size_t i = 1; i <= 6; i++) {
+        tracer.Free(tracer.Allocate(i * 16, 8));
+    }
+
+    ASSERT_EQ(4, tracer.GetRecordCount());
+    EXPECT_EQ(8, tracer.GetDroppedRecordCount());
+
+    // The last two allocations with their frees are kept, oldest first
+    EXPECT_EQ(AllocationTraceEvent::Allocate, tracer.GetRecord(0).Event);
+    EXPECT_EQ(5 * 16, tracer.GetRecord(0).Size);
+    EXPECT_EQ(AllocationTraceEvent::Free, tracer.GetRecord(1).Event);
+    EXPECT_EQ(6 * 16, tracer.GetRecord(2).Size);
+    EXPECT_EQ(11, tracer.GetRecord(3).Timestamp);
+
+    tracer.ClearRecords();
+    EXPECT_EQ(0, tracer.GetRecordCount());
+    EXPECT_EQ(0, tracer.GetDroppedRecordCount());
+}
+
+TEST_F(TestTracingMemoryAllocator, TestSerialize) {
+    TracingMemoryAllocator tracer{m_heap, SizedBuffer<AllocationTraceRecord>{m_records, 4}};
+
+    for (size_t i = 1; i <= 3; i++) {
+        tracer.Free(tracer.Allocate(i * 16, 8));
+    }
+
+    uint8_t output[sizeof(AllocationTraceHeader) + 4 * sizeof(AllocationTraceRecord)];
+    SizedBuffer<uint8_t> outputBuffer{output, sizeof(output)};
+    ASSERT_EQ(sizeof(output), tracer.GetSerializedSize());
+    ASSERT_EQ(sizeof(output), tracer.Serialize(outputBuffer));
+
+    const auto* header = reinterpret_cast<const AllocationTraceHeader*>(output);
+    EXPECT_EQ(ALLOCATION_TRACE_MAGIC, header->Magic);
+    EXPECT_EQ(ALLOCATION_TRACE_VERSION, header->Version);
+    EXPECT_EQ(4, header->RecordCount);
+    EXPECT_EQ(2, header->DroppedRecordCount);
+
+    const auto* records = reinterpret_cast<const AllocationTraceRecord*>(output + sizeof(AllocationTraceHeader));
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(tracer.GetRecord(i).Timestamp, records[i].Timestamp);
+        EXPECT_EQ(tracer.GetRecord(i).Address, records[i].Address);
+    }
+}
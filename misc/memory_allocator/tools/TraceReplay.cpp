@@ -0,0 +1,408 @@
+/*
+ * Replays allocation traces recorded by TracingMemoryAllocator against the allocators in this library and reports
+ * their throughput, peak memory footprint and fragmentation.
+ *
+ * Usage:
+ *   FunnyOS_Misc_MemoryAllocator_TraceReplay <trace>...
+ *   FunnyOS_Misc_MemoryAllocator_TraceReplay --synthetic <output trace>
+ */
+#include "Common.hpp"
+#include <FunnyOS/Misc/MemoryAllocator/StaticFragmentedMemoryAllocator.hpp>
+#include <FunnyOS/Misc/MemoryAllocator/StaticMemoryAllocator.hpp>
+#include <FunnyOS/Misc/MemoryAllocator/TracingMemoryAllocator.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace FunnyOS::Misc::MemoryAllocator;
+using FunnyOS::Stdlib::Memory::SizedBuffer;
+
+namespace {
+    /**
+     * Size of the memory given to every replayed allocator.
+     */
+    constexpr const size_t REPLAY_MEMORY_SIZE = 256 * 1024 * 1024;
+
+    /**
+     * Slot of operations whose memory is not tracked, for example frees of memory allocated before the trace begins.
+     */
+    constexpr const size_t NO_SLOT = ~static_cast<size_t>(0);
+
+    /**
+     * A trace record with the addresses replaced by slot numbers, so the replay does not need any address lookups.
+     */
+    struct ReplayOperation {
+        AllocationTraceEvent Event;
+        size_t Slot;
+        size_t PreviousSlot;
+        size_t Size;
+        size_t Alignment;
+    };
+
+    struct ReplayTrace {
+        std::vector<ReplayOperation> Operations;
+        size_t SlotCount;
+        size_t SkippedRecords;
+    };
+
+    /**
+     * An allocator that traces can be replayed against. New allocators only need a new entry in GetReplayTargets.
+     */
+    struct ReplayTarget {
+        const char* Name;
+        std::function<std::unique_ptr<IMemoryAllocator>(memoryaddress_t, memoryaddress_t)> Create;
+        std::function<size_t(const IMemoryAllocator&)> GetFootprint;
+    };
+
+    struct ReplayResult {
+        double Seconds;
+        size_t FailedOperations;
+        size_t PeakFootprint;
+        size_t LiveBytesAtPeak;
+    };
+
+    size_t GetFootprint(const StaticMemoryAllocator& allocator) {
+        return static_cast<size_t>(allocator.GetCurrentMemoryTop() - allocator.GetMemoryStart());
+    }
+
+    std::vector<ReplayTarget> GetReplayTargets() {
+        std::vector<ReplayTarget> targets;
+
+        targets.push_back(ReplayTarget{
+            "StaticMemoryAllocator",
+            [](memoryaddress_t start, memoryaddress_t end) {
+                auto allocator = std::make_unique<StaticMemoryAllocator>();
+                allocator->Initialize(start, end);
+                return std::unique_ptr<IMemoryAllocator>(std::move(allocator));
+            },
+            [](const IMemoryAllocator& allocator) {
+                return GetFootprint(static_cast<const StaticMemoryAllocator&>(allocator));
+            }});
+
+        targets.push_back(ReplayTarget{
+            "StaticFragmentedMemoryAllocator",
+            [](memoryaddress_t start, memoryaddress_t end) {
+                // Mimic a physical memory map: a few fragments of growing size, separated by holes
+                const memoryaddress_t size = end - start;
+                const memoryaddress_t hole = 64 * 1024;
+
+                MemoryFragment fragments[] = {
+                    {start, start + size / 16},
+                    {start + size / 16 + hole, start + size / 4},
+                    {start + size / 4 + hole, start + size / 2},
+                    {start + size / 2 + hole, end},
+                };
+
+                auto allocator = std::make_unique<StaticFragmentedMemoryAllocator>();
+                allocator->Initialize(SizedBuffer<MemoryFragment>{fragments, 4});
+                return std::unique_ptr<IMemoryAllocator>(std::move(allocator));
+            },
+            [](const IMemoryAllocator& allocator) {
+                size_t footprint = 0;
+
+                for (const auto& member :
+                     static_cast<const StaticFragmentedMemoryAllocator&>(allocator).GetMemberAllocators()) {
+                    footprint += GetFootprint(member);
+                }
+
+                return footprint;
+            }});
+
+        return targets;
+    }
+
+    bool ReadTrace(const char* path, std::vector<AllocationTraceRecord>& records, AllocationTraceHeader& header) {
+        FILE* file = fopen(path, "rb");
+        if (file == nullptr) {
+            fprintf(stderr, "Cannot open %s\n", path);
+            return false;
+        }
+
+        bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.Magic == ALLOCATION_TRACE_MAGIC &&
+                  header.Version == ALLOCATION_TRACE_VERSION;
+
+        if (ok) {
+            records.resize(header.RecordCount);
+            ok = fread(records.data(), sizeof(AllocationTraceRecord), records.size(), file) == records.size();
+        }
+
+        fclose(file);
+
+        if (!ok) {
+            fprintf(stderr, "%s is not a valid allocation trace\n", path);
+        }
+
+        return ok;
+    }
+
+    ReplayTrace PrepareTrace(const std::vector<AllocationTraceRecord>& records) {
+        ReplayTrace trace{{}, 0, 0};
+        std::unordered_map<uint64_t, size_t> liveSlots;
+
+        auto takeSlot = [&](uint64_t address) {
+            auto it = liveSlots.find(address);
+            if (it == liveSlots.end()) {
+                return NO_SLOT;
+            }
+
+            const size_t slot = it->second;
+            liveSlots.erase(it);
+            return slot;
+        };
+
+        for (const auto& record : records) {
+            ReplayOperation operation{
+                record.Event, NO_SLOT, NO_SLOT, record.Size, static_cast<size_t>(1) << record.AlignmentShift};
+
+            switch (record.Event) {
+                case AllocationTraceEvent::Allocate:
+                    if (record.Address == 0) {
+                        trace.SkippedRecords++;
+                        continue;
+                    }
+
+                    operation.Slot            = trace.SlotCount++;
+                    liveSlots[record.Address] = operation.Slot;
+                    break;
+
+                case AllocationTraceEvent::Free:
+                    operation.Slot = takeSlot(record.Address);
+                    if (operation.Slot == NO_SLOT) {
+                        trace.SkippedRecords++;
+                        continue;
+                    }
+                    break;
+
+                case AllocationTraceEvent::Reallocate:
+                    if (record.Address == 0) {
+                        trace.SkippedRecords++;
+                        continue;
+                    }
+
+                    // Memory allocated before the trace begins is allocated from scratch
+                    operation.PreviousSlot = takeSlot(record.PreviousAddress);
+                    operation.Event =
+                        operation.PreviousSlot == NO_SLOT ? AllocationTraceEvent::Allocate : operation.Event;
+                    operation.Slot            = trace.SlotCount++;
+                    liveSlots[record.Address] = operation.Slot;
+                    break;
+
+                default:
+                    trace.SkippedRecords++;
+                    continue;
+            }
+
+            trace.Operations.push_back(operation);
+        }
+
+        return trace;
+    }
+
+    template <bool Measure>
+    ReplayResult Replay(const ReplayTarget& target, const ReplayTrace& trace, uint8_t* memory) {
+        const auto start    = reinterpret_cast<memoryaddress_t>(memory);
+        auto allocator      = target.Create(start, start + REPLAY_MEMORY_SIZE);
+        ReplayResult result = {0, 0, 0, 0};
+        size_t liveBytes    = 0;
+        std::vector<void*> slots(trace.SlotCount, nullptr);
+        std::vector<size_t> slotSizes(Measure ? trace.SlotCount : 0, 0);
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for (const auto& operation : trace.Operations) {
+            void* newMemory = nullptr;
+
+            switch (operation.Event) {
+                case AllocationTraceEvent::Allocate:
+                    newMemory = allocator->Allocate(operation.Size, operation.Alignment);
+                    break;
+
+                case AllocationTraceEvent::Free:
+                    if (slots[operation.Slot] != nullptr) {
+                        allocator->Free(slots[operation.Slot]);
+                    }
+                    break;
+
+                case AllocationTraceEvent::Reallocate:
+                    newMemory = slots[operation.PreviousSlot] != nullptr
+                                        ? allocator->Reallocate(slots[operation.PreviousSlot], operation.Size,
+                                                                operation.Alignment)
+                                        : allocator->Allocate(operation.Size, operation.Alignment);
+                    break;
+            }
+
+            if (operation.Event != AllocationTraceEvent::Free) {
+                slots[operation.Slot] = newMemory;
+                result.FailedOperations += newMemory == nullptr ? 1 : 0;
+            }
+
+            if constexpr (Measure) {
+                if (operation.Event == AllocationTraceEvent::Free || operation.Event == AllocationTraceEvent::Reallocate) {
+                    const size_t freedSlot = operation.Event == AllocationTraceEvent::Free ? operation.Slot
+                                                                                           : operation.PreviousSlot;
+                    if (freedSlot != NO_SLOT) {
+                        liveBytes -= slotSizes[freedSlot];
+                        slotSizes[freedSlot] = 0;
+                    }
+                }
+
+                if (operation.Event != AllocationTraceEvent::Free && newMemory != nullptr) {
+                    slotSizes[operation.Slot] = operation.Size;
+                    liveBytes += operation.Size;
+                }
+
+                const size_t footprint = target.GetFootprint(*allocator);
+                if (footprint > result.PeakFootprint) {
+                    result.PeakFootprint   = footprint;
+                    result.LiveBytesAtPeak = liveBytes;
+                }
+            }
+        }
+
+        const auto endTime = std::chrono::steady_clock::now();
+        result.Seconds     = std::chrono::duration<double>(endTime - startTime).count();
+
+        return result;
+    }
+
+    void ReplayFile(const char* path, uint8_t* memory) {
+        std::vector<AllocationTraceRecord> records;
+        AllocationTraceHeader header{};
+
+        if (!ReadTrace(path, records, header)) {
+            return;
+        }
+
+        const ReplayTrace trace = PrepareTrace(records);
+        printf("%s: %zu operations, %zu skipped records, %llu records dropped while tracing\n", path,
+               trace.Operations.size(), trace.SkippedRecords, static_cast<unsigned long long>(header.DroppedRecordCount));
+        printf("%-34s %10s %10s %16s %16s %14s %8s\n", "Allocator", "Mops/s", "ns/op", "Peak footprint",
+               "Live at peak", "Fragmentation", "Failed");
+
+        for (const auto& target : GetReplayTargets()) {
+            const ReplayResult timing  = Replay<false>(target, trace, memory);
+            const ReplayResult metrics = Replay<true>(target, trace, memory);
+
+            const double operations    = static_cast<double>(trace.Operations.size());
+            const double fragmentation = metrics.PeakFootprint == 0
+                                             ? 0.0
+                                             : 100.0 * (1.0 - static_cast<double>(metrics.LiveBytesAtPeak) /
+                                                                  static_cast<double>(metrics.PeakFootprint));
+
+            printf("%-34s %10.2f %10.1f %16zu %16zu %13.1f%% %8zu\n", target.Name,
+                   operations / timing.Seconds / 1e6, timing.Seconds * 1e9 / operations, metrics.PeakFootprint,
+                   metrics.LiveBytesAtPeak, fragmentation, timing.FailedOperations);
+        }
+    }
+
+    uint64_t GetHostTimestamp() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    /**
+     * Records a synthetic trace, resembling the kernel: many small short-lived objects, growing buffers and a few
+     * page-aligned allocations.
+     */
+    bool RecordSyntheticTrace(const char* path, uint8_t* memory) {
+        constexpr const size_t OPERATION_COUNT = 200000;
+
+        StaticMemoryAllocator heap;
+        heap.Initialize(reinterpret_cast<memoryaddress_t>(memory),
+                        reinterpret_cast<memoryaddress_t>(memory) + REPLAY_MEMORY_SIZE);
+
+        std::vector<AllocationTraceRecord> records(OPERATION_COUNT * 2);
+        TracingMemoryAllocator tracer{heap, SizedBuffer<AllocationTraceRecord>{records.data(), records.size()},
+                                      GetHostTimestamp};
+
+        std::mt19937 random{1234};
+        std::vector<void*> live;
+        std::vector<size_t> sizes;
+
+        for (size_t i = 0; i < OPERATION_COUNT; i++) {
+            const unsigned int choice = random() % 100;
+
+            if (choice < 50 || live.empty()) {
+                const size_t size      = choice < 2 ? 4096 : 16 + random() % 240;
+                const size_t alignment = choice < 2 ? 4096 : 8;
+                void* allocated        = tracer.Allocate(size, alignment);
+
+                if (allocated != nullptr) {
+                    live.push_back(allocated);
+                    sizes.push_back(size);
+                }
+            } else if (choice < 60) {
+                const size_t index = random() % live.size();
+                void* reallocated  = tracer.Reallocate(live[index], sizes[index] * 2, 8);
+
+                if (reallocated != nullptr) {
+                    live[index]  = reallocated;
+                    sizes[index] = sizes[index] * 2;
+                }
+            } else {
+                // Mostly LIFO, like temporaries on the kernel heap
+                const size_t index = random() % 4 == 0 ? random() % live.size() : live.size() - 1;
+                tracer.Free(live[index]);
+                live[index]  = live.back();
+                sizes[index] = sizes.back();
+                live.pop_back();
+                sizes.pop_back();
+            }
+        }
+
+        std::vector<uint8_t> output(tracer.GetSerializedSize());
+        SizedBuffer<uint8_t> outputBuffer{output.data(), output.size()};
+        tracer.Serialize(outputBuffer);
+
+        FILE* file = fopen(path, "wb");
+        if (file == nullptr) {
+            fprintf(stderr, "Cannot open %s\n", path);
+            return false;
+        }
+
+        const bool written = fwrite(output.data(), 1, output.size(), file) == output.size();
+        fclose(file);
+
+        if (!written) {
+            fprintf(stderr, "Cannot write %s\n", path);
+            return false;
+        }
+
+        printf("Recorded %zu operations to %s\n", tracer.GetRecordCount(), path);
+        return true;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace>...\n       %s --synthetic <output trace>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    auto* memory = static_cast<uint8_t*>(aligned_alloc(4096, REPLAY_MEMORY_SIZE));
+    if (memory == nullptr) {
+        fprintf(stderr, "Cannot allocate the replay memory\n");
+        return 1;
+    }
+
+    int status = 0;
+
+    if (strcmp(argv[1], "--synthetic") == 0) {
+        status = argc == 3 && RecordSyntheticTrace(argv[2], memory) ? 0 : 1;
+    } else {
+        for (int i = 1; i < argc; i++) {
+            ReplayFile(argv[i], memory);
+        }
+    }
+
+    free(memory);
+    return status;
+}
@@ -1,6 +1,10 @@
 #ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_ALGORITHM_HPP
 #define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_ALGORITHM_HPP
 
+#include "System.hpp"
+#include "IntegerTypes.hpp"
+#include "Utility.hpp"
+
 namespace FunnyOS::Stdlib {
 
     /**
@@ -99,6 +103,21 @@ namespace FunnyOS::Stdlib {
     template <typename Iterator, typename Matcher, typename Eraser>
     size_t RemoveIf(Iterator begin, Iterator end, Matcher matcher, Eraser eraser);
 
+    /**
+     * Moves every element between [begin] (inclusive) and [end] (exclusive) that does not match the predicate
+     * [matcher] to the front of the range, keeping their order. Each element is tested exactly once and moved at most
+     * once, so contiguous containers can remove any number of elements in a single pass.
+     *
+     * @tparam Iterator type of the iterators
+     * @tparam Matcher type of the matcher
+     * @param begin iterator pointing to the start of the range (inclusive).
+     * @param end iterator pointing to the end of the range (exclusive).
+     * @param matcher matcher to test elements
+     * @return iterator one after the last kept element, the elements from there to [end] are left moved-from
+     */
+    template <typename Iterator, typename Matcher>
+    Iterator Compact(Iterator begin, Iterator end, Matcher matcher);
+
     /**
      * Removes every element on the given container that matches the predicate [matcher].
      *
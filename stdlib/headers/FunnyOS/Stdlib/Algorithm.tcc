@@ -81,6 +81,23 @@ namespace FunnyOS::Stdlib {
         return erased;
     }
 
+    template <typename Iterator, typename Matcher>
+    Iterator Compact(Iterator begin, Iterator end, Matcher matcher) {
+        Iterator kept = Find(begin, end, matcher);
+        if (kept == end) {
+            return end;
+        }
+
+        for (Iterator current = kept + 1; current != end; current++) {
+            if (!matcher(*current)) {
+                *kept = Move(*current);
+                kept++;
+            }
+        }
+
+        return kept;
+    }
+
     template <typename Container, typename Iterator, typename Matcher, typename ContainerEraser>
     size_t RemoveIf(Container& container, Matcher matcher) {
         static ContainerEraser c_eraser;
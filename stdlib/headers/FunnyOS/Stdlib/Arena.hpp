@@ -0,0 +1,178 @@
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_ARENA_HPP
+#define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_ARENA_HPP
+
+#include "IntegerTypes.hpp"
+#include "System.hpp"
+
+namespace FunnyOS::Stdlib {
+
+    /**
+     * Bump allocator for short-lived allocations that are all discarded at once.
+     *
+     * Memory is taken from the platform heap in chunks of at least the chunk size given in the constructor, allocating
+     * is only a pointer bump inside the current chunk. Freeing individual allocations is a no-op, except for the most
+     * recent allocation which is rolled back, so a growing Vector or string reallocates in place. All memory is
+     * released at once by Reset or when the arena is destructed.
+     *
+     * An arena is used explicitly by calling its methods, or implicitly by activating it with an ArenaScope, in which
+     * case all Memory::Allocate* calls (and therefore new expressions and all containers) use the arena. Memory freed
+     * through Memory::Free is always given back to the allocator that owns it, regardless of the active scope.
+     *
+     * Arenas are not thread-safe. Objects allocated in an arena must be destroyed before the arena is reset or
+     * destroyed.
+     */
+    class Arena {
+       public:
+        NON_COPYABLE(Arena);
+        NON_MOVEABLE(Arena);
+
+        /**
+         * Default size of a single chunk.
+         */
+        static constexpr const size_t DEFAULT_CHUNK_SIZE = 4096;
+
+        /**
+         * Constructs a new empty arena, no memory is allocated until the first allocation.
+         *
+         * @param chunkSize minimum size of a single chunk taken from the heap
+         */
+        explicit Arena(size_t chunkSize = DEFAULT_CHUNK_SIZE) noexcept;
+
+        /**
+         * Releases all chunks of the arena.
+         */
+        ~Arena();
+
+        /**
+         * Allocates a chunk of memory from the arena.
+         *
+         * @param[in] size size of the memory
+         * @param[in] alignment memory alignment, must be a power of two
+         * @return the newly allocated memory or nullptr if the heap is out of memory.
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment) noexcept;
+
+        /**
+         * Reallocates a chunk of memory allocated by this arena. The most recent allocation is resized in place if the
+         * current chunk has enough space.
+         *
+         * @param[in,out] ptr memory previously allocated by this arena
+         * @param[in] size new size of the memory
+         * @param[in] alignment memory alignment, must be a power of two
+         * @return the reallocated memory or nullptr if the heap is out of memory.
+         */
+        [[nodiscard]] void* Reallocate(void* ptr, size_t size, size_t alignment) noexcept;
+
+        /**
+         * Frees a chunk of memory allocated by this arena. Only the most recent allocation is actually reclaimed, the
+         * memory of other allocations is reclaimed by Reset.
+         *
+         * @param[in] ptr memory previously allocated by this arena
+         */
+        void Free(void* ptr) noexcept;
+
+        /**
+         * Discards all allocations made by this arena. The first chunk is kept for later allocations, all others are
+         * given back to the heap.
+         */
+        void Reset() noexcept;
+
+        /**
+         * Checks whether the given memory belongs to this arena.
+         *
+         * @param ptr pointer to check
+         * @return whether or not the memory was allocated by this arena
+         */
+        [[nodiscard]] bool Owns(const void* ptr) const noexcept;
+
+        /**
+         * Gets the amount of chunks currently held by this arena.
+         *
+         * @return the amount of chunks
+         */
+        [[nodiscard]] size_t GetChunkCount() const noexcept;
+
+        /**
+         * Gets the arena activated by the innermost ArenaScope.
+         *
+         * @return the active arena or nullptr if there is none
+         */
+        [[nodiscard]] static Arena* GetActive() noexcept;
+
+        /**
+         * Finds the arena that owns the given memory. The chunks of all arenas are kept in a sorted registry, so the
+         * lookup does not walk the chunks of every arena and never reads memory outside of them.
+         *
+         * @param ptr pointer returned by an allocation function, from an arena or not
+         * @return the arena that allocated the memory or nullptr if no arena did
+         */
+        [[nodiscard]] static Arena* FindOwner(const void* ptr) noexcept;
+
+       private:
+        /**
+         * Header present at the beginning of every chunk.
+         */
+        struct ChunkHeader {
+            /**
+             * The chunk allocated before this one.
+             */
+            ChunkHeader* Previous;
+
+            /**
+             * Size of the chunk, without this header.
+             */
+            size_t Size;
+        };
+
+        /**
+         * Allocates a new chunk that can hold at least [size] bytes aligned to [alignment] and makes it current.
+         *
+         * @return whether or not the chunk was allocated
+         */
+        bool AddChunk(size_t size, size_t alignment) noexcept;
+
+        /**
+         * Makes the given chunk the current one, the whole chunk is free after this call.
+         */
+        void UseChunk(ChunkHeader* chunk) noexcept;
+
+       private:
+        friend class ArenaScope;
+
+        size_t m_chunkSize;
+        ChunkHeader* m_currentChunk;
+        uintptr_t m_currentPosition;
+        uintptr_t m_currentEnd;
+        void* m_lastAllocation;
+    };
+
+    /**
+     * Makes an Arena active for the lifetime of this object.
+     *
+     * While a scope is alive all Memory::Allocate* calls allocate from its arena. Scopes can be nested, the previously
+     * active arena is restored when a scope is destroyed.
+     */
+    class ArenaScope {
+       public:
+        NON_COPYABLE(ArenaScope);
+        NON_MOVEABLE(ArenaScope);
+
+        /**
+         * Activates the given arena.
+         *
+         * @param arena arena to activate, must outlive this scope
+         */
+        explicit ArenaScope(Arena& arena) noexcept;
+
+        /**
+         * Restores the previously active arena.
+         */
+        ~ArenaScope();
+
+       private:
+        Arena* m_previousActive;
+    };
+
+}  // namespace FunnyOS::Stdlib
+
+#endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_ARENA_HPP
@@ -14,19 +14,31 @@
 #   define F_SECTION(sectionName)               __attribute__((section(sectionName)))
 #   define F_UNUSED                             __attribute__((unused))
 #   define F_NAKED                              __attribute__((naked))
+#   define F_TARGET(features)                   __attribute__((target(features)))
+#   define F_NO_SANITIZE_ADDRESS                __attribute__((no_sanitize_address))
 
 // Struct alignment
 #   define F_DONT_ALIGN                         __attribute__((packed))
 
+// Type attributes, for types used to access memory that may be unaligned and may contain any object
+#   define F_MAY_ALIAS                          __attribute__((may_alias))
+#   define F_UNALIGNED                          __attribute__((aligned(1)))
+#   define F_VECTOR(size)                       __attribute__((vector_size(size)))
+
 // Debugging
 #   define F_UNIVERSAL_DEBUGGER_TRAP asm volatile ("xchg %bx, %bx")
 
+// Bit manipulation, the result is undefined if x is 0
+#   define F_COUNT_TRAILING_ZEROS_64(x)         __builtin_ctzll(x)
+#   define F_COUNT_LEADING_ZEROS_64(x)          __builtin_clzll(x)
+
 // Varags
 #include <stdarg.h>
 
 // Misc
 #   define F_MEMORY_FENCE                       asm volatile ("" ::: "memory")
 #   define F_FETCH_CALLER_ADDRESS()             (static_cast<void*>(__builtin_return_address(0)))
+#   define F_FETCH_FRAME_ADDRESS()              (static_cast<void*>(__builtin_frame_address(0)))
 
 #   define _F_TO_STRING_HELPER(x) #x
 #   define F_TO_STRING(x) _F_TO_STRING_HELPER(x)
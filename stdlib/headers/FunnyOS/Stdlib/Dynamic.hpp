@@ -2,6 +2,7 @@
 #define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_DYNAMIC_HPP
 
 #include "Memory.hpp"
+#include "ObjectCache.hpp"
 
 namespace FunnyOS::Stdlib {
 
@@ -183,7 +184,8 @@ namespace FunnyOS::Stdlib {
             inline RefCounter Acquire();
 
             /**
-             * If counter is initialized it is decremented by [1].
+             * If counter is initialized it is decremented by [1]. If it reaches [0] the counter is freed and this
+             * ref counter becomes uninitialized.
              *
              * @return if this operation set the counter value to [0].
              */
@@ -287,6 +289,15 @@ namespace FunnyOS::Stdlib {
     template <typename T, typename... Args>
     Ref<T> MakeRef(Args&&... args);
 
+    /**
+     * Owners and Refs only hold pointers, so they can be moved by copying their bytes.
+     */
+    template <typename T, typename Deleter>
+    constexpr bool IsTriviallyRelocatable<Owner<T, Deleter>> = IsTriviallyRelocatable<Deleter>;
+
+    template <typename T>
+    constexpr bool IsTriviallyRelocatable<Ref<T>> = true;
+
     /**
      * Creates a new instance of Ref<T> that owns the same object as [ref].
      * Conversion from U* to T* is done via [ static_cast<T*>(ref.Get()) ].
@@ -166,7 +166,7 @@ namespace FunnyOS::Stdlib {
         RefCounter::RefCounter() : m_counter{nullptr} {}
 
         void RefCounter::Initialize() {
-            m_counter = new unsigned int{1};
+            m_counter = ObjectCache<unsigned int>::New(1U);
         }
 
         RefCounter RefCounter::Acquire() {
@@ -186,7 +186,14 @@ namespace FunnyOS::Stdlib {
                 return false;
             }
 
-            return --(*m_counter) == 0;
+            if (--(*m_counter) != 0) {
+                return false;
+            }
+
+            // This was the last owner, the counter is no longer needed
+            ObjectCache<unsigned int>::Delete(m_counter);
+            m_counter = nullptr;
+            return true;
         }
 
         void RefCounter::Invalidate() {
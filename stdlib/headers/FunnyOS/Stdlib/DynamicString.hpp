@@ -7,15 +7,24 @@
 #include "Hash.hpp"
 #include "IntegerTypes.hpp"
 #include "Memory.hpp"
+#include "StringView.hpp"
 #include "Vector.hpp"
 
 namespace FunnyOS::Stdlib {
 
     /**
-     * Exception thrown when the accessed index of a string is greater than the maximum allowed.
+     * Exception thrown when a string could not allocate memory for its characters.
      */
-    F_TRIVIAL_EXCEPTION_WITH_MESSAGE(StringIndexOutOfBounds);
+    F_TRIVIAL_EXCEPTION_WITH_MESSAGE(StringNotEnoughMemory);
 
+    /**
+     * A null-terminated, growable string.
+     *
+     * Short strings are stored inline, in the memory that holds the heap pointer, size and capacity of long strings,
+     * so they never allocate. The last character of the inline storage holds the amount of unused inline characters,
+     * which is 0 - the terminator - when the inline storage is full. Heap strings set the highest bit of the capacity,
+     * which shares its last byte with that character, on a little-endian platform.
+     */
     template <typename T>
     class BasicDynamicString {
        public:
@@ -29,9 +38,36 @@ namespace FunnyOS::Stdlib {
          */
         using ConstIterator = const T*;
 
+        /**
+         * Maximum amount of characters stored without a heap allocation.
+         */
+        constexpr const static size_t INLINE_CAPACITY = 3 * sizeof(size_t) / sizeof(T) - 1;
+
        public:
-        TRIVIALLY_COPYABLE(BasicDynamicString);
-        TRIVIALLY_MOVEABLE(BasicDynamicString);
+        /**
+         * Constructs a copy of [other], a heap allocation is made only if the string does not fit inline.
+         */
+        BasicDynamicString(const BasicDynamicString& other);
+
+        /**
+         * Replaces the characters of this string with a copy of the characters of [other].
+         */
+        BasicDynamicString& operator=(const BasicDynamicString& other);
+
+        /**
+         * Moves the characters of [other] to a new string, [other] is left empty.
+         */
+        BasicDynamicString(BasicDynamicString&& other) noexcept;
+
+        /**
+         * Replaces the characters of this string with the characters of [other], [other] is left empty.
+         */
+        BasicDynamicString& operator=(BasicDynamicString&& other) noexcept;
+
+        /**
+         * Frees the heap memory of the string, if it has any.
+         */
+        ~BasicDynamicString();
 
         /**
          * Constructs a new, empty string, this does not allocate anything on the heap.
@@ -70,6 +106,13 @@ namespace FunnyOS::Stdlib {
          */
         BasicDynamicString(const Memory::SizedBuffer<T>& buffer);
 
+        /**
+         * Constructs a new string that copies all characters from a view
+         *
+         * @param view view to copy characters from
+         */
+        explicit BasicDynamicString(BasicStringView<T> view);
+
        public:
         /**
          * Gets the size of the string, the actual number of characters inside it.
@@ -79,12 +122,20 @@ namespace FunnyOS::Stdlib {
         [[nodiscard]] size_t Size() const noexcept;
 
         /**
-         * Resizes the string's heap to match the size of the string.
+         * Gets the amount of characters the string can hold without reallocating, at least INLINE_CAPACITY.
+         *
+         * @return capacity of the string
+         */
+        [[nodiscard]] size_t Capacity() const noexcept;
+
+        /**
+         * Resizes the string's heap to match the size of the string, a string that fits inline is moved back to the
+         * inline storage and its heap memory is freed.
          */
         void ShrinkToSize();
 
         /**
-         * Ensures that the string's heap is large enough to hold at least [num] characters.
+         * Ensures that the string is large enough to hold at least [num] characters.
          *
          * @param num number of character that string's must be able to contain.
          */
@@ -92,7 +143,7 @@ namespace FunnyOS::Stdlib {
 
         /**
          * Gets the character at N'th index of the string
-         *TRIVIALLY_
+         *
          * @param index index
          * @return the N'th character
          *
@@ -106,7 +157,7 @@ namespace FunnyOS::Stdlib {
          * @param index index
          * @return  the N'th element
          *
-         * @throws VectorIndexOutOfBounds when index >= GetSize()
+         * @throws StringIndexOutOfBounds when index >= GetSize()
          */
         [[nodiscard]] const T& operator[](size_t index) const;
 
@@ -163,29 +214,27 @@ namespace FunnyOS::Stdlib {
         void ToUppercase();
 
         /**
-         * Clears the entire string
+         * Clears the entire string, the capacity of the string is kept.
          */
         void Clear();
 
         /**
-         * Returns a reference to a vector that can be used to view or modify the string's allocated heap data.
-         */
-        Vector<T>& AsVectorView();
-
-        /**
-         * Returns a reference to a const vector that can be used to view the string's allocated heap data.
+         * Returns a const reference to the string's characters.
          */
-        const Vector<T>& AsVectorView() const;
+        const T* AsCString() const;
 
         /**
-         * Returns a const reference to the string's characters.
+         * Returns a view of the string's characters, valid until the string is modified or destroyed.
          */
-        const T* AsCString() const;
+        operator BasicStringView<T>() const noexcept;
 
         bool operator==(const BasicDynamicString<T>& other) const;
 
         bool operator!=(const BasicDynamicString<T>& other) const;
 
+        /**
+         * Checks whether or not the string is not empty.
+         */
         operator bool() const;
 
         /**
@@ -219,10 +268,62 @@ namespace FunnyOS::Stdlib {
         HAS_STANDARD_ITERATORS;
 
        private:
-        void RequireBuffer();
+        /**
+         * Representation of a string stored on the heap.
+         */
+        struct HeapStorage {
+            T* Data;
+            size_t Size;
+
+            /**
+             * Amount of characters that fit in [Data] without the terminator, with HEAP_FLAG set.
+             */
+            size_t Capacity;
+        };
+
+        static_assert(sizeof(HeapStorage) == (INLINE_CAPACITY + 1) * sizeof(T), "inline storage must overlay the heap");
+
+        /**
+         * Set in the capacity of heap strings, no inline size has this bit set.
+         */
+        constexpr const static size_t HEAP_FLAG = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+
+        [[nodiscard]] bool IsInline() const noexcept;
+
+        [[nodiscard]] T* Data() noexcept;
+
+        [[nodiscard]] const T* Data() const noexcept;
+
+        /**
+         * Sets the size of the string and writes its terminator, [size] must not exceed the capacity.
+         */
+        void SetSize(size_t size) noexcept;
+
+        /**
+         * Moves the characters to a storage of the given capacity, the inline storage if they fit in it.
+         * [capacity] must not be smaller than the size of the string.
+         */
+        void Reallocate(size_t capacity);
+
+        /**
+         * Inserts [count] characters at [index], the characters must not be a part of this string.
+         */
+        void InsertCharacters(size_t index, const T* characters, size_t count);
+
+        /**
+         * Removes [count] characters starting at [index].
+         */
+        void RemoveCharacters(size_t index, size_t count) noexcept;
+
+        void CheckBounds(size_t index) const;
+
+        void FreeHeap() noexcept;
 
        private:
-        Vector<T> m_data;
+        union {
+            HeapStorage m_heap;
+            T m_inline[INLINE_CAPACITY + 1];
+        };
     };
 
     template <typename T>
@@ -230,6 +331,18 @@ namespace FunnyOS::Stdlib {
         hash_t operator()(const BasicDynamicString<T>& obj);
     };
 
+    /**
+     * Neither the heap nor the inline storage point into the string itself.
+     */
+    template <typename T>
+    constexpr bool IsTriviallyRelocatable<BasicDynamicString<T>> = true;
+
+    /**
+     * A view can query a map with string keys.
+     */
+    template <typename T>
+    constexpr bool IsHeterogeneousKey<BasicDynamicString<T>, BasicStringView<T>> = true;
+
     using DynamicString = BasicDynamicString<char>;
 
 }  // namespace FunnyOS::Stdlib
@@ -7,74 +7,147 @@
 
 #ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_DYNAMICSTRING_TCC
 #define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_DYNAMICSTRING_TCC
+#include "Algorithm.hpp"
 
 namespace FunnyOS::Stdlib {
 
     template <typename T>
-    BasicDynamicString<T>::BasicDynamicString() : m_data{} {}
+    BasicDynamicString<T>::BasicDynamicString(const BasicDynamicString& other) : BasicDynamicString{} {
+        InsertCharacters(0, other.Data(), other.Size());
+    }
+
+    template <typename T>
+    BasicDynamicString<T>& BasicDynamicString<T>::operator=(const BasicDynamicString& other) {
+        if (&other == this) {
+            return *this;
+        }
+
+        SetSize(0);
+        InsertCharacters(0, other.Data(), other.Size());
+        return *this;
+    }
+
+    template <typename T>
+    BasicDynamicString<T>::BasicDynamicString(BasicDynamicString&& other) noexcept : m_heap{other.m_heap} {
+        // Copying the heap representation copies the inline characters too
+        other.m_heap = {nullptr, 0, 0};
+        other.SetSize(0);
+    }
+
+    template <typename T>
+    BasicDynamicString<T>& BasicDynamicString<T>::operator=(BasicDynamicString&& other) noexcept {
+        if (&other == this) {
+            return *this;
+        }
+
+        FreeHeap();
+        m_heap = other.m_heap;
+
+        other.m_heap = {nullptr, 0, 0};
+        other.SetSize(0);
+        return *this;
+    }
+
+    template <typename T>
+    BasicDynamicString<T>::~BasicDynamicString() {
+        FreeHeap();
+    }
+
+    template <typename T>
+    BasicDynamicString<T>::BasicDynamicString() : m_heap{nullptr, 0, 0} {
+        SetSize(0);
+    }
 
     template <typename T>
     BasicDynamicString<T>::BasicDynamicString(size_t count, const char* pattern) : BasicDynamicString{} {
-        m_data.EnsureCapacity(count);
+        EnsureCapacity(count);
 
         const size_t patternSize = String::Length(pattern);
+        T* data                  = Data();
 
         for (size_t i = 0; i < count; i++) {
-            m_data.Append(patternSize == 0 ? 0 : pattern[i % patternSize]);
+            data[i] = patternSize == 0 ? 0 : pattern[i % patternSize];
         }
 
-        m_data.Append(0);
+        SetSize(count);
     }
 
     template <typename T>
     BasicDynamicString<T>::BasicDynamicString(const T* data) : BasicDynamicString{data, 0, String::Length(data)} {}
 
     template <typename T>
-    BasicDynamicString<T>::BasicDynamicString(const T* data, size_t offset, size_t length) {
-        m_data.EnsureCapacity(length + 1);
-        m_data.Insert(0, data + offset, length);
-        m_data.Append(0);
+    BasicDynamicString<T>::BasicDynamicString(const T* data, size_t offset, size_t length) : BasicDynamicString{} {
+        InsertCharacters(0, data + offset, length);
     }
 
     template <typename T>
     BasicDynamicString<T>::BasicDynamicString(const Memory::SizedBuffer<T>& buffer)
         : BasicDynamicString{buffer.Data, 0, buffer.Size} {}
 
+    template <typename T>
+    BasicDynamicString<T>::BasicDynamicString(BasicStringView<T> view)
+        : BasicDynamicString{view.Data(), 0, view.Size()} {}
+
     template <typename T>
     size_t BasicDynamicString<T>::Size() const noexcept {
-        return m_data.Size() == 0 ? 0 : (m_data.Size() - 1);
+        if (IsInline()) {
+            return INLINE_CAPACITY - static_cast<size_t>(m_inline[INLINE_CAPACITY]);
+        }
+
+        return m_heap.Size;
+    }
+
+    template <typename T>
+    size_t BasicDynamicString<T>::Capacity() const noexcept {
+        return IsInline() ? INLINE_CAPACITY : (m_heap.Capacity & ~HEAP_FLAG);
     }
 
     template <typename T>
     void BasicDynamicString<T>::ShrinkToSize() {
-        m_data.ShrinkToSize();
+        if (!IsInline() && Size() != Capacity()) {
+            Reallocate(Size());
+        }
     }
 
     template <typename T>
     void BasicDynamicString<T>::EnsureCapacity(size_t num) {
-        m_data.EnsureCapacity(num);
+        if (num <= Capacity()) {
+            return;
+        }
+
+        Reallocate(Max(num, Capacity() * 2));
     }
 
     template <typename T>
     T& BasicDynamicString<T>::operator[](size_t index) {
-        return m_data[index];
+        CheckBounds(index);
+        return Data()[index];
     }
 
     template <typename T>
     const T& BasicDynamicString<T>::operator[](size_t index) const {
-        return m_data[index];
+        CheckBounds(index);
+        return Data()[index];
     }
 
     template <typename T>
     void BasicDynamicString<T>::Append(const BasicDynamicString<T>& value) {
-        RequireBuffer();
-        m_data.Insert(m_data.Size() - 1, value.Begin(), value.Size());
+        if (&value == this) {
+            // The characters would be freed when the string grows
+            Append(BasicDynamicString<T>{value});
+            return;
+        }
+
+        InsertCharacters(Size(), value.Data(), value.Size());
     }
 
     template <typename T>
     void BasicDynamicString<T>::Append(T character) {
-        RequireBuffer();
-        m_data.Insert(m_data.Size() - 1, character);
+        const size_t size = Size();
+        EnsureCapacity(size + 1);
+
+        Data()[size] = character;
+        SetSize(size + 1);
     }
 
     template <typename T>
@@ -86,7 +159,7 @@ namespace FunnyOS::Stdlib {
         size_t matchCount = 0;
 
         for (size_t i = 0; i < Size(); i++) {
-            if (m_data[i] == from[matchCount]) {
+            if (Data()[i] == from[matchCount]) {
                 matchCount++;
             } else {
                 matchCount = 0;
@@ -95,11 +168,12 @@ namespace FunnyOS::Stdlib {
             if (matchCount == from.Size()) {
                 const size_t startingIndex = i - matchCount + 1;
 
-                // we have a match
-                m_data.RemoveRange(startingIndex, i);
-                m_data.Insert(startingIndex, to.Begin(), to.Size());
+                // we have a match, the search continues right after the replacement
+                RemoveCharacters(startingIndex, matchCount);
+                InsertCharacters(startingIndex, to.Data(), to.Size());
 
-                i = startingIndex + to.Size();
+                i          = startingIndex + to.Size() - 1;
+                matchCount = 0;
             }
         }
     }
@@ -126,25 +200,21 @@ namespace FunnyOS::Stdlib {
 
         // count leading
         size_t leading = 0;
-        while (leading < Size() && String::Matches(m_data[leading], characterSet)) {
+        while (leading < Size() && String::Matches(Data()[leading], characterSet)) {
             leading++;
         }
 
         // remove leading
-        if (leading != 0) {
-            m_data.RemoveRange(0, leading - 1);
-        }
+        RemoveCharacters(0, leading);
 
         // count trailing
-        ssize_t trailingStart = Size() - 1;
-        while (trailingStart >= 0 && String::Matches(m_data[trailingStart], characterSet)) {
+        size_t trailingStart = Size();
+        while (trailingStart > 0 && String::Matches(Data()[trailingStart - 1], characterSet)) {
             trailingStart--;
         }
 
         // remove trailing
-        if (static_cast<size_t>(trailingStart) != Size() - 1) {
-            m_data.RemoveRange(trailingStart + 1, Size() - 1);
-        }
+        RemoveCharacters(trailingStart, Size() - trailingStart);
     }
 
     template <typename T>
@@ -163,36 +233,30 @@ namespace FunnyOS::Stdlib {
 
     template <typename T>
     void BasicDynamicString<T>::Clear() {
-        m_data.Clear();
+        SetSize(0);
     }
 
     template <typename T>
-    Vector<T>& BasicDynamicString<T>::AsVectorView() {
-        return m_data;
-    }
-
-    template <typename T>
-    const Vector<T>& BasicDynamicString<T>::AsVectorView() const {
-        return m_data;
+    const T* BasicDynamicString<T>::AsCString() const {
+        return Data();
     }
 
     template <typename T>
-    const T* BasicDynamicString<T>::AsCString() const {
-        if (Size() == 0) {
-            return "";
-        }
-
-        return m_data.Begin();
+    BasicDynamicString<T>::operator BasicStringView<T>() const noexcept {
+        return BasicStringView<T>{Data(), Size()};
     }
 
     template <typename T>
     bool BasicDynamicString<T>::operator==(const BasicDynamicString<T>& other) const {
-        if (m_data.Size() != other.m_data.Size()) {
+        if (Size() != other.Size()) {
             return false;
         }
 
-        for (size_t i = 0; i < m_data.Size(); i++) {
-            if (m_data[i] != other.m_data[i]) {
+        const T* data      = Data();
+        const T* otherData = other.Data();
+
+        for (size_t i = 0; i < Size(); i++) {
+            if (data[i] != otherData[i]) {
                 return false;
             }
         }
@@ -207,45 +271,127 @@ namespace FunnyOS::Stdlib {
 
     template <typename T>
     BasicDynamicString<T>::operator bool() const {
-        return this->m_data.Size() != 0;
+        return Size() != 0;
     }
 
     template <typename T>
     typename BasicDynamicString<T>::Iterator BasicDynamicString<T>::Begin() noexcept {
-        return m_data.Begin();
+        return Data();
     }
 
     template <typename T>
     typename BasicDynamicString<T>::Iterator BasicDynamicString<T>::End() noexcept {
-        return m_data.End() - 1;
+        return Data() + Size();
     }
 
     template <typename T>
     typename BasicDynamicString<T>::ConstIterator BasicDynamicString<T>::Begin() const noexcept {
-        return m_data.Begin();
+        return Data();
     }
 
     template <typename T>
     typename BasicDynamicString<T>::ConstIterator BasicDynamicString<T>::End() const noexcept {
-        return m_data.End() - 1;
+        return Data() + Size();
+    }
+
+    template <typename T>
+    bool BasicDynamicString<T>::IsInline() const noexcept {
+        return (m_heap.Capacity & HEAP_FLAG) == 0;
+    }
+
+    template <typename T>
+    T* BasicDynamicString<T>::Data() noexcept {
+        return IsInline() ? m_inline : m_heap.Data;
     }
 
     template <typename T>
-    void BasicDynamicString<T>::RequireBuffer() {
-        if (m_data.Size() == 0) {
-            m_data.Append(0);
+    const T* BasicDynamicString<T>::Data() const noexcept {
+        return IsInline() ? m_inline : m_heap.Data;
+    }
+
+    template <typename T>
+    void BasicDynamicString<T>::SetSize(size_t size) noexcept {
+        // For a full inline string the terminator and the amount of unused characters are the same 0
+        Data()[size] = 0;
+
+        if (IsInline()) {
+            m_inline[INLINE_CAPACITY] = static_cast<T>(INLINE_CAPACITY - size);
+        } else {
+            m_heap.Size = size;
         }
     }
 
     template <typename T>
-    hash_t Hash<BasicDynamicString<T>>::operator()(const BasicDynamicString<T>& obj) {
-        hash_t hash = 0;
+    void BasicDynamicString<T>::Reallocate(size_t capacity) {
+        const size_t size = Size();
+
+        if (capacity <= INLINE_CAPACITY) {
+            if (IsInline()) {
+                return;
+            }
+
+            // The characters overwrite the heap representation, the last one clears HEAP_FLAG
+            T* heapData = m_heap.Data;
+            Memory::Copy(m_inline, heapData, size);
+            Memory::Free(heapData);
+
+            m_inline[INLINE_CAPACITY] = static_cast<T>(INLINE_CAPACITY - size);
+            m_inline[size]            = 0;
+            return;
+        }
+
+        T* data = static_cast<T*>(Memory::Allocate((capacity + 1) * sizeof(T)));
+        if (data == nullptr) {
+            F_ERROR_WITH_MESSAGE(StringNotEnoughMemory, "string could not allocate enough memory");
+        }
+
+        Memory::Copy(data, Data(), size + 1);
+        FreeHeap();
+
+        m_heap = {data, size, capacity | HEAP_FLAG};
+    }
+
+    template <typename T>
+    void BasicDynamicString<T>::InsertCharacters(size_t index, const T* characters, size_t count) {
+        const size_t size = Size();
+        EnsureCapacity(size + count);
+
+        T* data = Data();
+        Memory::Move(data + index + count, data + index, (size - index) * sizeof(T));
+        Memory::Copy(data + index, characters, count);
+        SetSize(size + count);
+    }
+
+    template <typename T>
+    void BasicDynamicString<T>::RemoveCharacters(size_t index, size_t count) noexcept {
+        if (count == 0) {
+            return;
+        }
 
-        for (const T character : obj) {
-            hash = 31 * hash + character;
+        const size_t size = Size();
+        T* data           = Data();
+
+        Memory::Move(data + index, data + index + count, (size - index - count) * sizeof(T));
+        SetSize(size - count);
+    }
+
+    template <typename T>
+    void BasicDynamicString<T>::CheckBounds(size_t index) const {
+        if (index >= Size()) {
+            F_ERROR_WITH_MESSAGE(StringIndexOutOfBounds, "string index out of bounds");
         }
+    }
 
-        return hash;
+    template <typename T>
+    void BasicDynamicString<T>::FreeHeap() noexcept {
+        if (!IsInline()) {
+            Memory::Free(m_heap.Data);
+        }
+    }
+
+    template <typename T>
+    hash_t Hash<BasicDynamicString<T>>::operator()(const BasicDynamicString<T>& obj) {
+        return HashBytes(obj.AsCString(), obj.Size() * sizeof(T));
     }
 
 }  // namespace FunnyOS::Stdlib
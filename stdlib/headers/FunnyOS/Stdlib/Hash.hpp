@@ -2,27 +2,62 @@
 #define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_HASH_HPP
 
 #include "IntegerTypes.hpp"
+#include "TypeTraits.hpp"
 
 namespace FunnyOS::Stdlib {
 
     using hash_t = size_t;
 
+    /**
+     * Hashes a block of memory.
+     *
+     * The memory is read a word at a time and the words are mixed with a 64x64->128 bit multiplication, in the style
+     * of wyhash. Every bit of the input affects every bit of the result, so the low bits can be used directly to
+     * select a bucket of a power-of-two table.
+     *
+     * @param data memory to hash
+     * @param size size of the memory in bytes
+     * @param seed seed of the hash, different seeds give unrelated hashes of the same data
+     * @return the hash
+     */
+    [[nodiscard]] hash_t HashBytes(const void* data, size_t size, hash_t seed = 0) noexcept;
+
+    /**
+     * Mixes the bits of an integer, so integers that differ only in a few bits get completely different hashes.
+     * This is the finalizer of SplitMix64, it is a bijection and MixInteger(0) is 0.
+     *
+     * @param value integer to mix
+     * @return the hash
+     */
+    [[nodiscard]] constexpr hash_t MixInteger(uint64_t value) noexcept {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+        return static_cast<hash_t>(value ^ (value >> 31));
+    }
+
+    /**
+     * Hashes objects by their bytes. Types whose equal values may have different bytes, like types with padding or
+     * floating point numbers, must specialize Hash.
+     */
     template <typename T>
     struct Hash {
+        static_assert(HasUniqueObjectRepresentations<T>, "Hash must be specialized for this type");
+
         hash_t operator()(const T& obj) {
-            // TODO: Do it better
-            return reinterpret_cast<hash_t>(&obj);
+            return HashBytes(&obj, sizeof(T));
         }
     };
 
-#define NUMERIC_HASH(type)                   \
-    template <>                              \
-    struct Hash<type> {                      \
-        hash_t operator()(const type& obj) { \
-            return static_cast<hash_t>(obj); \
-        }                                    \
+#define NUMERIC_HASH(type)                                  \
+    template <>                                             \
+    struct Hash<type> {                                     \
+        hash_t operator()(const type& obj) {                \
+            return MixInteger(static_cast<uint64_t>(obj));  \
+        }                                                   \
     };
 
+    NUMERIC_HASH(bool);
+    NUMERIC_HASH(char);
     NUMERIC_HASH(int8_t);
     NUMERIC_HASH(int16_t);
     NUMERIC_HASH(int32_t);
@@ -34,6 +69,13 @@ namespace FunnyOS::Stdlib {
 
 #undef NUMERIC_HASH
 
+    /**
+     * Whether a HashMap with keys of type K can be queried with keys of type Q, without constructing a K.
+     * A specialization must guarantee that Hash<K> and Hash<Q> agree for equal keys and that K == Q compiles.
+     */
+    template <typename K, typename Q>
+    constexpr bool IsHeterogeneousKey = false;
+
 }  // namespace FunnyOS::Stdlib
 
 #endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_HASH_HPP
@@ -3,13 +3,13 @@
 
 #include "Functional.hpp"
 #include "Hash.hpp"
-#include "LinkedList.hpp"
-#include "Vector.hpp"
+#include "Memory.hpp"
 
 namespace FunnyOS::Stdlib {
 
     F_TRIVIAL_EXCEPTION_WITH_MESSAGE(HashMapKeyNotExists);
     F_TRIVIAL_EXCEPTION_WITH_MESSAGE(HashMapKeyAlreadyExists);
+    F_TRIVIAL_EXCEPTION_WITH_MESSAGE(HashMapNotEnoughMemory);
 
     template <typename K, typename V>
     struct HashMapEntry {
@@ -19,6 +19,24 @@ namespace FunnyOS::Stdlib {
         HashMapEntry(K key, V value);
     };
 
+    /**
+     * A hash map with open addressing.
+     *
+     * The entries are stored inline, in a single table with a power-of-two capacity. Collisions are resolved with
+     * Robin Hood linear probing: an entry that is further from its home slot takes the place of one that is closer to
+     * its own, which keeps the probe sequences short and lets a lookup stop as soon as it reaches an entry closer to
+     * its home than the searched key would be. Removed entries are filled by shifting the rest of their probe
+     * sequence back, so the table never has tombstones.
+     *
+     * The table grows incrementally. When it gets full a table twice as big is allocated, new entries go to it and
+     * every following insertion or removal moves a few entries of the old table over. Lookups check both tables until
+     * the old one is empty, so no single insertion pays for moving the whole map.
+     *
+     * Pointers to the values are invalidated by any insertion or removal.
+     *
+     * Lookups also accept keys of any type Q for which IsHeterogeneousKey<K, Q> is true, like a StringView for a map
+     * with DynamicString keys, so no temporary key has to be constructed.
+     */
     template <typename K, typename V>
     class HashMap {
        public:
@@ -44,6 +62,11 @@ namespace FunnyOS::Stdlib {
          */
         constexpr const static size_t DEFAULT_INITIAL_CAPACITY = 16;
 
+        /**
+         * The smallest capacity of the table.
+         */
+        constexpr const static size_t MINIMUM_CAPACITY = 8;
+
         /**
          * A const type used to iterate over this hashmap
          */
@@ -57,12 +80,12 @@ namespace FunnyOS::Stdlib {
              *
              * @return *this
              */
-            ConstIterator operator++() noexcept;
+            ConstIterator& operator++() noexcept;
 
             /**
              * Increment this iterator by one.
              *
-             * @return *this
+             * @return copy of this iterator from before the increment
              */
             ConstIterator operator++(int) noexcept;
 
@@ -119,10 +142,9 @@ namespace FunnyOS::Stdlib {
 
            protected:
             const HashMap& m_map;
-            size_t m_bucketIndex;
-            size_t m_keyIndex;
+            size_t m_slotIndex;
 
-            ConstIterator(const HashMap& map, size_t bucketIndex, size_t keyIndex);
+            ConstIterator(const HashMap& map, size_t slotIndex);
 
             void SkipInvalid();
 
@@ -157,14 +179,23 @@ namespace FunnyOS::Stdlib {
             HashMapEntry<K, V>* operator->() noexcept;
 
            private:
-            Iterator(HashMap& map, size_t bucketIndex, size_t keyIndex);
+            Iterator(HashMap& map, size_t slotIndex);
 
             friend class HashMap;
         };
 
        public:
         NON_COPYABLE(HashMap);
-        TRIVIALLY_MOVEABLE(HashMap);
+
+        /**
+         * Moves the entries of [other] to a new HashMap, [other] is left empty.
+         */
+        HashMap(HashMap&& other) noexcept;
+
+        /**
+         * Destroys all entries of this HashMap and moves the entries of [other] to it, [other] is left empty.
+         */
+        HashMap& operator=(HashMap&& other) noexcept;
 
         /**
          * Constructs a new empty HashMap with the default load factor
@@ -177,10 +208,17 @@ namespace FunnyOS::Stdlib {
         HashMap(load_factor_t loadFactor);
 
         /**
-         * Constructs a new empty HashMap with the given initial capacity and load factor
+         * Constructs a new empty HashMap with the given initial capacity and load factor.
+         * The capacity is rounded up to a power of two and the load factor is limited to 7/8, above that the probe
+         * sequences of an open addressing table get too long.
          */
         HashMap(size_t initialCapacity, load_factor_t loadFactor);
 
+        /**
+         * Destroys all entries.
+         */
+        ~HashMap();
+
         /**
          * Gets the size of the HashMap, the actual number of elements inside it.
          *
@@ -222,6 +260,24 @@ namespace FunnyOS::Stdlib {
          */
         [[nodiscard]] const V* GetOptional(const K& key) const;
 
+        /**
+         * Gets the element associated with a key equal to the given one
+         *
+         * @param key key of another type, that can be compared with the keys of the map
+         * @return the element or nullptr if the key does not exist
+         */
+        template <typename Q, typename = EnableIf<IsHeterogeneousKey<K, Q>>>
+        [[nodiscard]] V* GetOptional(const Q& key);
+
+        /**
+         * Gets the element associated with a key equal to the given one
+         *
+         * @param key key of another type, that can be compared with the keys of the map
+         * @return the element or nullptr if the key does not exist
+         */
+        template <typename Q, typename = EnableIf<IsHeterogeneousKey<K, Q>>>
+        [[nodiscard]] const V* GetOptional(const Q& key) const;
+
         /**
          * Inserts a value at the given key.
          *
@@ -260,6 +316,14 @@ namespace FunnyOS::Stdlib {
          */
         bool Remove(const K& key);
 
+        /**
+         * Removes an element associated with a key equal to the given one.
+         *
+         * @return true if the element was removed, false if there was no element associated with the given key
+         */
+        template <typename Q, typename = EnableIf<IsHeterogeneousKey<K, Q>>>
+        bool Remove(const Q& key);
+
         /**
          * Checks if the given key exists in the hashmap.
          *
@@ -267,6 +331,14 @@ namespace FunnyOS::Stdlib {
          */
         bool ContainsKey(const K& key);
 
+        /**
+         * Checks if a key equal to the given one exists in the hashmap.
+         *
+         * @return true if there is an element associated with the given key, false if there is none
+         */
+        template <typename Q, typename = EnableIf<IsHeterogeneousKey<K, Q>>>
+        bool ContainsKey(const Q& key);
+
         /**
          * Checks if the given value exists in the hashmap.
          *
@@ -310,22 +382,144 @@ namespace FunnyOS::Stdlib {
         HAS_STANDARD_ITERATORS;
 
        private:
-        struct Bucket {
-            LinkedList<HashMapEntry<K, V>> Values;
+        using Entry = HashMapEntry<K, V>;
+
+        /**
+         * A slot of the table, the entry is constructed in place in the storage of a used slot.
+         */
+        struct Slot {
+            /**
+             * 0 if the slot is empty, otherwise the distance of the entry from its home slot + 1.
+             */
+            size_t Distance;
+
+            alignas(Entry) uint8_t Storage[sizeof(Entry)];
+
+            [[nodiscard]] inline Entry& GetEntry() noexcept;
+
+            [[nodiscard]] inline const Entry& GetEntry() const noexcept;
         };
 
-        const load_factor_t m_loadFactor;
-        Vector<Bucket> m_buckets;
-        size_t m_size;
+        /**
+         * A table of slots with a power-of-two capacity.
+         */
+        struct Table {
+            Memory::SizedBuffer<Slot> Slots;
+
+            /**
+             * Amount of entries in the table.
+             */
+            size_t Size;
+        };
+
+        /**
+         * Returned by FindSlot if the key does not exist.
+         */
+        constexpr const static size_t NO_SLOT = ~static_cast<size_t>(0);
+
+        /**
+         * Amount of slots of the old table migrated by every insertion or removal while the map grows.
+         * The old table holds at most 7/8 of its capacity and the new one accepts 7/8 of its capacity more before it
+         * has to grow again, so this is enough to finish the migration long before that.
+         */
+        constexpr const static size_t MIGRATION_STEPS = 8;
+
+        load_factor_t m_loadFactor;
+        Table m_table;
+        Table m_oldTable;
+        size_t m_migrationIndex;
+        size_t m_maximumSize;
 
        private:
-        void RecalculateBuckets();
+        template <typename Q>
+        [[nodiscard]] static size_t GetHomeSlot(const Table& table, const Q& key) noexcept;
+
+        template <typename Q>
+        [[nodiscard]] static size_t FindSlot(const Table& table, const Q& key);
+
+        /**
+         * Finds the entry of the given key in the new table, or in the old table if it was not migrated yet.
+         *
+         * @return the entry or nullptr if the key does not exist
+         */
+        template <typename Q>
+        [[nodiscard]] Entry* FindEntry(const Q& key) const;
+
+        /**
+         * Gets a slot by its iteration index, the slots of the new table come first and the slots of the old table
+         * follow them.
+         */
+        [[nodiscard]] const Slot& GetSlot(size_t index) const noexcept;
+
+        [[nodiscard]] size_t GetSlotCount() const noexcept;
+
+        /**
+         * Removes the entry of the given key from whichever table holds it.
+         */
+        template <typename Q>
+        bool RemoveKey(const Q& key);
+
+        /**
+         * Inserts an entry whose key does not exist yet, growing the table if needed.
+         *
+         * @return the inserted entry
+         */
+        Entry& InsertNew(K key, V value);
+
+        /**
+         * Places an entry into the table, the table must have a free slot.
+         *
+         * @return the placed entry
+         */
+        static Entry& Place(Table& table, Entry&& entry);
+
+        /**
+         * Destroys the entry in the given slot and shifts the rest of its probe sequence back.
+         */
+        static void EraseSlot(Table& table, size_t index);
+
+        /**
+         * Allocates a new, empty table with the given capacity. The map is not modified.
+         *
+         * @throws HashMapNotEnoughMemory if the table could not be allocated
+         */
+        static Table AllocateTable(size_t capacity);
+
+        /**
+         * Makes the given table the current one and updates the maximum size for its capacity.
+         */
+        void UseTable(Table table);
+
+        /**
+         * Starts moving the entries to a table twice as big. The current table becomes the old table and its entries
+         * are migrated by the following insertions and removals.
+         */
+        void Grow();
+
+        /**
+         * Migrates entries from the old table to the new one, the old table is freed once it is empty.
+         *
+         * @param steps maximum amount of old slots to migrate
+         */
+        void Migrate(size_t steps);
 
-        Bucket& GetBucket(const K& key);
+        /**
+         * Destroys all entries of the table and frees it.
+         */
+        static void DestroyTable(Table& table);
 
-        const Bucket& GetBucket(const K& key) const;
+        /**
+         * Destroys all entries and frees both tables.
+         */
+        void Destroy();
     };
 
+    /**
+     * The tables are on the heap, so a map can be moved by copying its bytes.
+     */
+    template <typename K, typename V>
+    constexpr bool IsTriviallyRelocatable<HashMap<K, V>> = true;
+
 }  // namespace FunnyOS::Stdlib
 
 #include "HashMap.tcc"
@@ -5,6 +5,7 @@
 #ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_HASHMAP_TCC
 #define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_HASHMAP_TCC
 #include "Algorithm.hpp"
+#include "New.hpp"
 
 namespace FunnyOS::Stdlib {
 
@@ -12,33 +13,33 @@ namespace FunnyOS::Stdlib {
     HashMapEntry<K, V>::HashMapEntry(K key, V value) : Key(Move(key)), Value(Move(value)) {}
 
     template <typename K, typename V>
-    typename HashMap<K, V>::ConstIterator HashMap<K, V>::ConstIterator::operator++() noexcept {
-        auto snapshot = *this;
-
-        m_keyIndex++;
+    typename HashMap<K, V>::ConstIterator& HashMap<K, V>::ConstIterator::operator++() noexcept {
+        m_slotIndex++;
         SkipInvalid();
 
-        return snapshot;
+        return *this;
     }
 
     template <typename K, typename V>
     typename HashMap<K, V>::ConstIterator HashMap<K, V>::ConstIterator::operator++(int) noexcept {
-        return operator++();
+        auto snapshot = *this;
+        operator++();
+        return snapshot;
     }
 
     template <typename K, typename V>
     const HashMapEntry<K, V>& HashMap<K, V>::ConstIterator::operator*() const noexcept {
-        return m_map.m_buckets[m_bucketIndex].Values[m_keyIndex];
+        return m_map.GetSlot(m_slotIndex).GetEntry();
     }
 
     template <typename K, typename V>
     const HashMapEntry<K, V>* HashMap<K, V>::ConstIterator::operator->() const noexcept {
-        return &m_map.m_buckets[m_bucketIndex].Values[m_keyIndex];
+        return &m_map.GetSlot(m_slotIndex).GetEntry();
     }
 
     template <typename K, typename V>
     bool HashMap<K, V>::ConstIterator::operator==(const HashMap::ConstIterator& other) const noexcept {
-        return &m_map == &other.m_map && m_bucketIndex == other.m_bucketIndex && m_keyIndex == other.m_keyIndex;
+        return &m_map == &other.m_map && m_slotIndex == other.m_slotIndex;
     }
 
     template <typename K, typename V>
@@ -48,7 +49,7 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     bool HashMap<K, V>::ConstIterator::operator==(HashMap::ConstIterator& other) noexcept {
-        return &m_map == &other.m_map && m_bucketIndex == other.m_bucketIndex && m_keyIndex == other.m_keyIndex;
+        return &m_map == &other.m_map && m_slotIndex == other.m_slotIndex;
     }
 
     template <typename K, typename V>
@@ -57,40 +58,74 @@ namespace FunnyOS::Stdlib {
     }
 
     template <typename K, typename V>
-    HashMap<K, V>::ConstIterator::ConstIterator(const HashMap<K, V>& map, size_t bucketIndex, size_t keyIndex)
-        : m_map{map}, m_bucketIndex{bucketIndex}, m_keyIndex{keyIndex} {
+    HashMap<K, V>::ConstIterator::ConstIterator(const HashMap<K, V>& map, size_t slotIndex)
+        : m_map{map}, m_slotIndex{slotIndex} {
         SkipInvalid();
     }
 
     template <typename K, typename V>
     void HashMap<K, V>::ConstIterator::SkipInvalid() {
-        if (m_bucketIndex >= m_map.m_buckets.Size()) {
-            return;
-        }
-
-        while (m_keyIndex >= m_map.m_buckets[m_bucketIndex].Values.Size()) {
-            m_bucketIndex++;
-            m_keyIndex = 0;
-
-            if (m_bucketIndex >= m_map.m_buckets.Size()) {
-                break;
-            }
+        // Used slots are found by their distances only, every step of a full iteration is O(1) on average
+        const size_t slotCount = m_map.GetSlotCount();
+        while (m_slotIndex < slotCount && m_map.GetSlot(m_slotIndex).Distance == 0) {
+            m_slotIndex++;
         }
     }
 
     template <typename K, typename V>
     HashMapEntry<K, V>& HashMap<K, V>::Iterator::operator*() noexcept {
-        return this->m_map.m_buckets[this->m_bucketIndex].Values[this->m_keyIndex];
+        return const_cast<HashMapEntry<K, V>&>(ConstIterator::operator*());
     }
 
     template <typename K, typename V>
     HashMapEntry<K, V>* HashMap<K, V>::Iterator::operator->() noexcept {
-        return &this->m_map.m_buckets[this->m_bucketIndex].Values[this->m_keyIndex];
+        return const_cast<HashMapEntry<K, V>*>(ConstIterator::operator->());
     }
 
     template <typename K, typename V>
-    HashMap<K, V>::Iterator::Iterator(HashMap<K, V>& map, size_t bucketIndex, size_t keyIndex)
-        : ConstIterator(map, bucketIndex, keyIndex) {}
+    HashMap<K, V>::Iterator::Iterator(HashMap<K, V>& map, size_t slotIndex) : ConstIterator(map, slotIndex) {}
+
+    template <typename K, typename V>
+    HashMapEntry<K, V>& HashMap<K, V>::Slot::GetEntry() noexcept {
+        return *reinterpret_cast<Entry*>(Storage);
+    }
+
+    template <typename K, typename V>
+    const HashMapEntry<K, V>& HashMap<K, V>::Slot::GetEntry() const noexcept {
+        return *reinterpret_cast<const Entry*>(Storage);
+    }
+
+    template <typename K, typename V>
+    HashMap<K, V>::HashMap(HashMap&& other) noexcept
+        : m_loadFactor{other.m_loadFactor},
+          m_table{other.m_table},
+          m_oldTable{other.m_oldTable},
+          m_migrationIndex{other.m_migrationIndex},
+          m_maximumSize{other.m_maximumSize} {
+        other.m_table       = {{nullptr, 0}, 0};
+        other.m_oldTable    = {{nullptr, 0}, 0};
+        other.m_maximumSize = 0;
+    }
+
+    template <typename K, typename V>
+    HashMap<K, V>& HashMap<K, V>::operator=(HashMap&& other) noexcept {
+        if (&other == this) {
+            return *this;
+        }
+
+        Destroy();
+
+        m_loadFactor     = other.m_loadFactor;
+        m_table          = other.m_table;
+        m_oldTable       = other.m_oldTable;
+        m_migrationIndex = other.m_migrationIndex;
+        m_maximumSize    = other.m_maximumSize;
+
+        other.m_table       = {{nullptr, 0}, 0};
+        other.m_oldTable    = {{nullptr, 0}, 0};
+        other.m_maximumSize = 0;
+        return *this;
+    }
 
     template <typename K, typename V>
     HashMap<K, V>::HashMap() : HashMap(DEFAULT_LOAD_FACTOR) {}
@@ -100,13 +135,27 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     HashMap<K, V>::HashMap(size_t initialCapacity, load_factor_t loadFactor)
-        : m_loadFactor{loadFactor}, m_buckets{initialCapacity, 2}, m_size{0} {
-        RecalculateBuckets();
+        : m_loadFactor{loadFactor},
+          m_table{{nullptr, 0}, 0},
+          m_oldTable{{nullptr, 0}, 0},
+          m_migrationIndex{0},
+          m_maximumSize{0} {
+        size_t capacity = MINIMUM_CAPACITY;
+        while (capacity < initialCapacity) {
+            capacity *= 2;
+        }
+
+        UseTable(AllocateTable(capacity));
+    }
+
+    template <typename K, typename V>
+    HashMap<K, V>::~HashMap() {
+        Destroy();
     }
 
     template <typename K, typename V>
     size_t HashMap<K, V>::Size() const noexcept {
-        return m_size;
+        return m_table.Size + m_oldTable.Size;
     }
 
     template <typename K, typename V>
@@ -122,7 +171,7 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     const V& HashMap<K, V>::operator[](const K& key) const {
-        V* value = GetOptional(key);
+        const V* value = GetOptional(key);
 
         if (value == nullptr) {
             F_ERROR_WITH_MESSAGE(HashMapKeyNotExists, "Key does not exist");
@@ -133,28 +182,28 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     V* HashMap<K, V>::GetOptional(const K& key) {
-        Bucket& bucket = GetBucket(key);
-
-        for (HashMapEntry<K, V>& entry : bucket.Values) {
-            if (entry.Key == key) {
-                return &entry.Value;
-            }
-        }
-
-        return nullptr;
+        Entry* entry = FindEntry(key);
+        return entry == nullptr ? nullptr : &entry->Value;
     }
 
     template <typename K, typename V>
     const V* HashMap<K, V>::GetOptional(const K& key) const {
-        const Bucket& bucket = GetBucket(key);
+        const Entry* entry = FindEntry(key);
+        return entry == nullptr ? nullptr : &entry->Value;
+    }
 
-        for (const HashMapEntry<K, V>& entry : bucket.Values) {
-            if (entry.Key == key) {
-                return &entry.Value;
-            }
-        }
+    template <typename K, typename V>
+    template <typename Q, typename>
+    V* HashMap<K, V>::GetOptional(const Q& key) {
+        Entry* entry = FindEntry(key);
+        return entry == nullptr ? nullptr : &entry->Value;
+    }
 
-        return nullptr;
+    template <typename K, typename V>
+    template <typename Q, typename>
+    const V* HashMap<K, V>::GetOptional(const Q& key) const {
+        const Entry* entry = FindEntry(key);
+        return entry == nullptr ? nullptr : &entry->Value;
     }
 
     template <typename K, typename V>
@@ -170,68 +219,52 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     V* HashMap<K, V>::InsertIfNotExist(K key, V value) {
-        Bucket& bucket = GetBucket(key);
-
-        for (HashMapEntry<K, V>& entry : bucket.Values) {
-            if (entry.Key == key) {
-                return nullptr;
-            }
+        if (FindEntry(key) != nullptr) {
+            return nullptr;
         }
 
-        m_size++;
-        auto& entry = bucket.Values.AppendInPlace(Move(key), Move(value));
-        RecalculateBuckets();
-        return &entry.Value;
+        return &InsertNew(Move(key), Move(value)).Value;
     }
 
     template <typename K, typename V>
     V* HashMap<K, V>::InsertOrReplace(K key, V value) {
-        Bucket& bucket = GetBucket(key);
+        Entry* entry = FindEntry(key);
 
-        for (HashMapEntry<K, V>& entry : bucket.Values) {
-            if (entry.Key == key) {
-                entry.Value = Move(value);
-                return &entry.Value;
-            }
+        if (entry != nullptr) {
+            entry->Value = Move(value);
+            return &entry->Value;
         }
 
-        m_size++;
-        auto& entry = bucket.Values.AppendInPlace(Move(key), Move(value));
-        RecalculateBuckets();
-        return &entry.Value;
+        return &InsertNew(Move(key), Move(value)).Value;
     }
 
     template <typename K, typename V>
     bool HashMap<K, V>::Remove(const K& key) {
-        Bucket& bucket = GetBucket(key);
-
-        const size_t removed =
-            Stdlib::RemoveIf(bucket.Values, [&](const HashMapEntry<K, V>& entry) { return entry.Key == key; });
+        return RemoveKey(key);
+    }
 
-        m_size -= removed;
-        return removed > 0;
+    template <typename K, typename V>
+    template <typename Q, typename>
+    bool HashMap<K, V>::Remove(const Q& key) {
+        return RemoveKey(key);
     }
 
     template <typename K, typename V>
     bool HashMap<K, V>::ContainsKey(const K& key) {
-        Bucket& bucket = GetBucket(key);
-
-        for (const HashMapEntry<K, V>& entry : bucket.Values) {
-            if (entry.Key == key) {
-                return true;
-            }
-        }
+        return FindEntry(key) != nullptr;
+    }
 
-        return false;
+    template <typename K, typename V>
+    template <typename Q, typename>
+    bool HashMap<K, V>::ContainsKey(const Q& key) {
+        return FindEntry(key) != nullptr;
     }
 
     template <typename K, typename V>
     bool HashMap<K, V>::ContainsValue(const V& value) {
-        for (Bucket& bucket : m_buckets) {
-            for (const HashMapEntry<K, V>& entry : bucket.Values) {
-                if (entry.Value == value) {
-                    return true;
-                }
+        for (const HashMapEntry<K, V>& entry : *this) {
+            if (entry.Value == value) {
+                return true;
             }
         }
 
@@ -240,75 +273,272 @@ namespace FunnyOS::Stdlib {
 
     template <typename K, typename V>
     void HashMap<K, V>::Clear() {
-        for (Bucket& bucket : m_buckets) {
-            bucket.Values.Clear();
+        DestroyTable(m_oldTable);
+
+        for (size_t i = 0; i < m_table.Slots.Size; i++) {
+            Slot& slot = m_table.Slots.Data[i];
+
+            if (slot.Distance != 0) {
+                slot.GetEntry().~Entry();
+                slot.Distance = 0;
+            }
         }
 
-        m_size = 0;
+        m_table.Size = 0;
     }
 
     template <typename K, typename V>
     typename HashMap<K, V>::Iterator HashMap<K, V>::Begin() noexcept {
-        return Size() == 0 ? End() : HashMap::Iterator(*this, 0, 0);
+        return Size() == 0 ? End() : HashMap::Iterator(*this, 0);
     }
 
     template <typename K, typename V>
     typename HashMap<K, V>::Iterator HashMap<K, V>::End() noexcept {
-        return HashMap::Iterator(*this, m_buckets.Size(), 0);
+        return HashMap::Iterator(*this, GetSlotCount());
     }
 
     template <typename K, typename V>
     typename HashMap<K, V>::ConstIterator HashMap<K, V>::Begin() const noexcept {
-        return Size() == 0 ? End() : HashMap::ConstIterator(*this, 0, 0);
+        return Size() == 0 ? End() : HashMap::ConstIterator(*this, 0);
     }
 
     template <typename K, typename V>
     typename HashMap<K, V>::ConstIterator HashMap<K, V>::End() const noexcept {
-        return HashMap::ConstIterator(*this, m_buckets.Size(), 0);
+        return HashMap::ConstIterator(*this, GetSlotCount());
+    }
+
+    template <typename K, typename V>
+    template <typename Q>
+    size_t HashMap<K, V>::GetHomeSlot(const Table& table, const Q& key) noexcept {
+        // The hashes are well mixed, so the capacity is a power of two and the low bits select the slot
+        return Hash<Q>{}(key) & (table.Slots.Size - 1);
     }
 
     template <typename K, typename V>
-    void HashMap<K, V>::RecalculateBuckets() {
-        if (m_size > m_buckets.Capacity() * m_loadFactor) {
-            // double the bucket count
-            m_buckets.EnsureCapacity(m_buckets.Capacity() * 2);
+    template <typename Q>
+    size_t HashMap<K, V>::FindSlot(const Table& table, const Q& key) {
+        if (table.Size == 0) {
+            return NO_SLOT;
         }
 
-        if (m_buckets.Size() >= m_buckets.Capacity()) {
-            return;
+        const size_t mask = table.Slots.Size - 1;
+        size_t index      = GetHomeSlot(table, key);
+
+        // An entry closer to its home than the key would be means that the key does not exist
+        for (size_t distance = 1; table.Slots.Data[index].Distance >= distance; distance++) {
+            if (table.Slots.Data[index].GetEntry().Key == key) {
+                return index;
+            }
+
+            index = (index + 1) & mask;
         }
 
-        const size_t previousCapacity = m_buckets.Size();
+        return NO_SLOT;
+    }
 
-        while (m_buckets.Size() < m_buckets.Capacity()) {
-            m_buckets.AppendInPlace();
+    template <typename K, typename V>
+    template <typename Q>
+    HashMapEntry<K, V>* HashMap<K, V>::FindEntry(const Q& key) const {
+        size_t index = FindSlot(m_table, key);
+        if (index != NO_SLOT) {
+            return &m_table.Slots.Data[index].GetEntry();
         }
 
-        // re-hash
-        for (size_t currentBucket = 0; currentBucket < previousCapacity; currentBucket++) {
-            Bucket& bucket = m_buckets[currentBucket];
+        index = FindSlot(m_oldTable, key);
+        if (index != NO_SLOT) {
+            return &m_oldTable.Slots.Data[index].GetEntry();
+        }
 
-            for (auto it = bucket.Values.Begin(); it != bucket.Values.End();) {
-                const size_t computedBucket = Hash<K>{}((*it).Key) % m_buckets.Size();
+        return nullptr;
+    }
+
+    template <typename K, typename V>
+    const typename HashMap<K, V>::Slot& HashMap<K, V>::GetSlot(size_t index) const noexcept {
+        if (index < m_table.Slots.Size) {
+            return m_table.Slots.Data[index];
+        }
+
+        return m_oldTable.Slots.Data[index - m_table.Slots.Size];
+    }
+
+    template <typename K, typename V>
+    size_t HashMap<K, V>::GetSlotCount() const noexcept {
+        return m_table.Slots.Size + m_oldTable.Slots.Size;
+    }
+
+    template <typename K, typename V>
+    template <typename Q>
+    bool HashMap<K, V>::RemoveKey(const Q& key) {
+        size_t index = FindSlot(m_table, key);
+
+        if (index != NO_SLOT) {
+            EraseSlot(m_table, index);
+        } else if ((index = FindSlot(m_oldTable, key)) != NO_SLOT) {
+            EraseSlot(m_oldTable, index);
+        } else {
+            return false;
+        }
+
+        Migrate(MIGRATION_STEPS);
+        return true;
+    }
+
+    template <typename K, typename V>
+    HashMapEntry<K, V>& HashMap<K, V>::InsertNew(K key, V value) {
+        Migrate(MIGRATION_STEPS);
+
+        if (Size() >= m_maximumSize) {
+            Grow();
+        }
+
+        return Place(m_table, Entry{Move(key), Move(value)});
+    }
+
+    template <typename K, typename V>
+    HashMapEntry<K, V>& HashMap<K, V>::Place(Table& table, Entry&& entry) {
+        const size_t mask = table.Slots.Size - 1;
+        size_t index      = GetHomeSlot(table, entry.Key);
+        size_t distance   = 1;
+        Entry* placed     = nullptr;
+        Entry pending{Move(entry)};
+
+        table.Size++;
+
+        while (true) {
+            Slot& slot = table.Slots.Data[index];
+
+            if (slot.Distance == 0) {
+                new (slot.Storage) Entry(Move(pending));
+                slot.Distance = distance;
+                return placed == nullptr ? slot.GetEntry() : *placed;
+            }
 
-                if (computedBucket != currentBucket) {
-                    m_buckets[computedBucket].Values.Append(Move(*it));
-                    it = bucket.Values.Erase(it);
-                } else {
-                    it++;
+            // Robin Hood, the entry that is closer to its home gives its slot away and continues probing
+            if (slot.Distance < distance) {
+                Entry displaced{Move(slot.GetEntry())};
+                slot.GetEntry() = Move(pending);
+                pending         = Move(displaced);
+
+                const size_t displacedDistance = slot.Distance;
+                slot.Distance                  = distance;
+                distance                       = displacedDistance;
+
+                if (placed == nullptr) {
+                    placed = &slot.GetEntry();
                 }
             }
+
+            index = (index + 1) & mask;
+            distance++;
+        }
+    }
+
+    template <typename K, typename V>
+    void HashMap<K, V>::EraseSlot(Table& table, size_t index) {
+        const size_t mask = table.Slots.Size - 1;
+        table.Slots.Data[index].GetEntry().~Entry();
+        table.Size--;
+
+        // Backward shift, entries that are not in their home slot move one slot closer to it
+        for (size_t next = (index + 1) & mask; table.Slots.Data[next].Distance > 1; next = (next + 1) & mask) {
+            Slot& slot     = table.Slots.Data[index];
+            Slot& nextSlot = table.Slots.Data[next];
+
+            new (slot.Storage) Entry(Move(nextSlot.GetEntry()));
+            nextSlot.GetEntry().~Entry();
+            slot.Distance = nextSlot.Distance - 1;
+
+            index = next;
+        }
+
+        table.Slots.Data[index].Distance = 0;
+    }
+
+    template <typename K, typename V>
+    typename HashMap<K, V>::Table HashMap<K, V>::AllocateTable(size_t capacity) {
+        Table table{Memory::AllocateBufferAligned<Slot>(capacity, alignof(Slot)), 0};
+        if (table.Slots.Data == nullptr) {
+            F_ERROR_WITH_MESSAGE(HashMapNotEnoughMemory, "hash map could not allocate enough memory");
+        }
+
+        for (size_t i = 0; i < capacity; i++) {
+            table.Slots.Data[i].Distance = 0;
+        }
+
+        return table;
+    }
+
+    template <typename K, typename V>
+    void HashMap<K, V>::UseTable(Table table) {
+        const size_t capacity = table.Slots.Size;
+        m_table               = table;
+
+        // The table is never completely full, so a probe sequence always ends
+        m_maximumSize = Max<size_t>(Min<size_t>(capacity * m_loadFactor, capacity - capacity / 8), 1);
+    }
+
+    template <typename K, typename V>
+    void HashMap<K, V>::Grow() {
+        // Only happens with tiny load factors, that leave too few insertions to migrate the old table in steps
+        Migrate(~static_cast<size_t>(0));
+
+        // Allocated before anything is changed, so the map stays usable if the allocation fails
+        const Table table = AllocateTable(Max(m_table.Slots.Size * 2, MINIMUM_CAPACITY));
+
+        if (m_table.Size == 0) {
+            DestroyTable(m_table);
+        } else {
+            m_oldTable       = m_table;
+            m_migrationIndex = 0;
+        }
+
+        UseTable(table);
+    }
+
+    template <typename K, typename V>
+    void HashMap<K, V>::Migrate(size_t steps) {
+        // Erasing from the old table keeps it a valid Robin Hood table for lookups. The backward shift may move another
+        // entry into the migrated slot, so the index only advances once the slot is empty. The slots before the index
+        // are empty and stay empty, the old table only shrinks.
+        for (; steps > 0 && m_oldTable.Size != 0; steps--) {
+            Slot& slot = m_oldTable.Slots.Data[m_migrationIndex];
+
+            if (slot.Distance == 0) {
+                m_migrationIndex++;
+                continue;
+            }
+
+            Place(m_table, Move(slot.GetEntry()));
+            EraseSlot(m_oldTable, m_migrationIndex);
+        }
+
+        if (m_oldTable.Size == 0 && m_oldTable.Slots.Data != nullptr) {
+            Memory::FreeBuffer(m_oldTable.Slots);
         }
     }
 
     template <typename K, typename V>
-    typename HashMap<K, V>::Bucket& HashMap<K, V>::GetBucket(const K& key) {
-        return m_buckets[Hash<K>{}(key) % m_buckets.Size()];
+    void HashMap<K, V>::DestroyTable(Table& table) {
+        if (table.Slots.Data == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < table.Slots.Size; i++) {
+            Slot& slot = table.Slots.Data[i];
+
+            if (slot.Distance != 0) {
+                slot.GetEntry().~Entry();
+            }
+        }
+
+        Memory::FreeBuffer(table.Slots);
+        table.Size = 0;
     }
 
     template <typename K, typename V>
-    const typename HashMap<K, V>::Bucket& HashMap<K, V>::GetBucket(const K& key) const {
-        return m_buckets[Hash<K>{}(key) % m_buckets.Size()];
+    void HashMap<K, V>::Destroy() {
+        DestroyTable(m_oldTable);
+        DestroyTable(m_table);
     }
 
 }  // namespace FunnyOS::Stdlib
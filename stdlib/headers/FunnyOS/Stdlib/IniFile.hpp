@@ -14,9 +14,14 @@ namespace FunnyOS::Stdlib {
 
         IniSection() = default;
 
-        DynamicString GetValue(const DynamicString& key) const;
+        /**
+         * Gets the value of a key.
+         *
+         * @return view of the value, valid until the section is modified, or an empty view if the key does not exist
+         */
+        StringView GetValue(StringView key) const;
 
-        void SetValue(const DynamicString& key, DynamicString value);
+        void SetValue(StringView key, DynamicString value);
 
         Vector<DynamicString> GetKeyNames() const;
 
@@ -26,19 +31,27 @@ namespace FunnyOS::Stdlib {
 
     class IniFile {
        public:
-        DynamicString GetValue(const DynamicString& section, const DynamicString& key) const;
+        /**
+         * Gets the value of a key in a section.
+         *
+         * @return view of the value, valid until the file is modified, or an empty view if the key does not exist
+         */
+        StringView GetValue(StringView section, StringView key) const;
 
-        DynamicString GetValueOrDefault(const DynamicString& section, const DynamicString& key, const char* defaultValue) const;
+        /**
+         * Gets the value of a key in a section, or [defaultValue] if the key does not exist or its value is empty.
+         */
+        StringView GetValueOrDefault(StringView section, StringView key, StringView defaultValue) const;
 
-        void SetValue(const DynamicString& section, const DynamicString& key, DynamicString value);
+        void SetValue(StringView section, StringView key, DynamicString value);
 
         IniSection& GetDefaultSection();
 
         const IniSection* GetDefaultSection() const;
 
-        IniSection& GetSection(const DynamicString& name);
+        IniSection& GetSection(StringView name);
 
-        const IniSection* GetSection(const DynamicString& name) const;
+        const IniSection* GetSection(StringView name) const;
 
         Vector<DynamicString> GetSectionNames() const;
        private:
@@ -4,6 +4,7 @@
 #include "System.hpp"
 #include "IntegerTypes.hpp"
 #include "Functional.hpp"
+#include "ObjectCache.hpp"
 
 namespace FunnyOS::Stdlib {
 
@@ -359,6 +360,8 @@ namespace FunnyOS::Stdlib {
 
        private:
         struct Element {
+            F_USE_OBJECT_CACHE(Element);
+
             Storage<T> Data;
             Element* Previous;
             Element* Next;
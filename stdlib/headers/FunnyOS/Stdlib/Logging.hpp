@@ -167,7 +167,7 @@ namespace FunnyOS::Stdlib {
         void RemoveSink(const ILoggingSink* sink);
 
        private:
-        Vector<Ref<ILoggingSink>> m_sinks{};
+        InlineVector<Ref<ILoggingSink>, 4> m_sinks{};
     };
 
 }  // namespace FunnyOS::Stdlib
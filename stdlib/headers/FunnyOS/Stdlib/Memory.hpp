@@ -102,9 +102,10 @@ namespace FunnyOS::Stdlib::Memory {
     /**
      * Copies [size] bytes from [source] to [destination].
      *
+     * The copy routine is selected at the first call, from the features of the CPU.
      * If [destination] and [source] overlap the behaviour is undefined.
      */
-    inline void Copy(void* destination, const void* source, size_t size) noexcept;
+    void Copy(void* destination, const void* source, size_t size) noexcept;
 
     /**
      * Copies [size] * sizeof(Type) bytes from [source] to [destination]
@@ -127,7 +128,7 @@ namespace FunnyOS::Stdlib::Memory {
      *
      * Supports overlapping destination and source.
      */
-    inline void Move(void* destination, const void* source, size_t size) noexcept;
+    void Move(void* destination, const void* source, size_t size) noexcept;
 
     /**
      * Sets [destination.Size] * sizeof(Type) bytes at [destination.Data] to [byte]
@@ -135,6 +136,13 @@ namespace FunnyOS::Stdlib::Memory {
     template <typename Type>
     inline void Set(SizedBuffer<Type>& destination, Type byte) noexcept;
 
+    /**
+     * Sets [size] bytes at [destination] to [byte].
+     *
+     * The set routine is selected at the first call, from the features of the CPU.
+     */
+    void Set(void* destination, uint8_t byte, size_t size) noexcept;
+
     /**
      * Fills the whole [destination] with repeating patterns of [pattern]
      */
@@ -48,27 +48,36 @@ namespace FunnyOS::Stdlib::Memory {
         return Data + Size;
     }
 
+    namespace _Internal {
+        /**
+         * Whether or not objects of the type can be copied with the byte routines.
+         */
+        template <typename Type>
+        constexpr bool IS_BYTE_COPYABLE = IsTriviallyCopyable<Type> && !IsVolatile<Type>;
+    }  // namespace _Internal
+
     template <typename Type>
     inline void Copy(SizedBuffer<Type>& destination, const Type* source) noexcept {
-        for (size_t i = 0; i < destination.Size; i++) {
-            destination.Data[i] = source[i];
-        }
-    }
-
-    inline void Copy(void* destination, const void* source, size_t size) noexcept {
-        Copy(static_cast<uint8_t*>(destination), static_cast<const uint8_t*>(source), size);
+        Copy(destination.Data, source, destination.Size);
     }
 
     template <typename Type>
     inline void Copy(Type* destination, const Type* source, size_t size) noexcept {
-        for (size_t i = 0; i < size; i++) {
-            destination[i] = source[i];
+        if constexpr (_Internal::IS_BYTE_COPYABLE<Type>) {
+            Copy(static_cast<void*>(destination), static_cast<const void*>(source), size * sizeof(Type));
+        } else {
+            for (size_t i = 0; i < size; i++) {
+                destination[i] = source[i];
+            }
         }
     }
 
     template <typename Type>
     inline void Move(SizedBuffer<Type>& destination, const Type* source) noexcept {
-        if (destination.Data < source) {
+        if constexpr (_Internal::IS_BYTE_COPYABLE<Type>) {
+            Move(static_cast<void*>(destination.Data), static_cast<const void*>(source),
+                 destination.Size * sizeof(Type));
+        } else if (destination.Data < source) {
             for (size_t i = 0; i < destination.Size; i++) {
                 destination.Data[i] = source[i];
             }
@@ -79,15 +88,14 @@ namespace FunnyOS::Stdlib::Memory {
         }
     }
 
-    inline void Move(void* destination, const void* source, size_t size) noexcept {
-        SizedBuffer<uint8_t> buffer = {static_cast<uint8_t*>(destination), size};
-        Move(buffer, static_cast<const uint8_t*>(source));
-    }
-
     template <typename Type>
     inline void Set(SizedBuffer<Type>& destination, Type byte) noexcept {
-        for (size_t i = 0; i < destination.Size; i++) {
-            *(destination.Data + i) = byte;
+        if constexpr (sizeof(Type) == 1 && _Internal::IS_BYTE_COPYABLE<Type>) {
+            Set(static_cast<void*>(destination.Data), *reinterpret_cast<const uint8_t*>(&byte), destination.Size);
+        } else {
+            for (size_t i = 0; i < destination.Size; i++) {
+                *(destination.Data + i) = byte;
+            }
         }
     }
 
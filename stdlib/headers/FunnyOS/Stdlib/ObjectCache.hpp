@@ -0,0 +1,242 @@
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_HPP
+#define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_HPP
+
+#include "IntegerTypes.hpp"
+#include "System.hpp"
+
+namespace FunnyOS::Stdlib {
+
+    /**
+     * Slab allocator for objects of a single size.
+     *
+     * Objects are allocated from slabs: SLAB_SIZE-aligned chunks of SLAB_SIZE bytes taken from the heap. Every slab
+     * starts with a header followed by the objects, free objects of a slab are linked in a free list stored in the
+     * objects themselves. The slab of an object is found by masking its address, so freeing is always O(1) and the
+     * objects carry no per-object allocator overhead.
+     *
+     * At most one completely free slab is kept by the cache, other free slabs are given back to the heap. All slabs
+     * are given back to the heap when the cache is destroyed.
+     */
+    class SlabCache {
+       public:
+        NON_COPYABLE(SlabCache);
+        NON_MOVEABLE(SlabCache);
+
+        /**
+         * Size and alignment of every slab.
+         */
+        static constexpr const size_t SLAB_SIZE = 4096;
+
+        /**
+         * Biggest object size for which using slabs makes sense.
+         */
+        static constexpr const size_t MAXIMUM_OBJECT_SIZE = SLAB_SIZE / 8;
+
+        /**
+         * Constructs a new cache for objects of the given size.
+         *
+         * @param objectSize size of every object
+         * @param objectAlignment alignment of every object, must be a power of two
+         */
+        constexpr SlabCache(size_t objectSize, size_t objectAlignment) noexcept;
+
+        /**
+         * Gives all slabs back to the heap. Objects still allocated from this cache become invalid.
+         */
+        ~SlabCache();
+
+        /**
+         * Allocates an object.
+         *
+         * @return pointer to the memory of the object or nullptr if the heap is out of memory
+         */
+        [[nodiscard]] void* Allocate() noexcept;
+
+        /**
+         * Frees an object previously allocated by Allocate from this cache.
+         *
+         * @param object object to free, may be nullptr
+         */
+        void Free(void* object) noexcept;
+
+        /**
+         * Gets the size of every object in this cache.
+         *
+         * @return size of every object
+         */
+        [[nodiscard]] size_t GetObjectSize() const noexcept;
+
+        /**
+         * Gets the amount of objects that fit in a single slab.
+         *
+         * @return the amount of objects per slab
+         */
+        [[nodiscard]] size_t GetObjectsPerSlab() const noexcept;
+
+        /**
+         * Gets the amount of slabs currently allocated by this cache.
+         *
+         * @return the amount of slabs
+         */
+        [[nodiscard]] size_t GetSlabCount() const noexcept;
+
+       private:
+        /**
+         * Header present at the beginning of every slab.
+         */
+        struct SlabHeader {
+            /**
+             * Cache that owns this slab.
+             */
+            SlabCache* Cache;
+
+            /**
+             * Next slab in the same list.
+             */
+            SlabHeader* Next;
+
+            /**
+             * Previous slab in the same list.
+             */
+            SlabHeader* Previous;
+
+            /**
+             * First free object in this slab, every free object holds a pointer to the next one.
+             */
+            void* FreeObjects;
+
+            /**
+             * Amount of objects in this slab that are currently allocated.
+             */
+            size_t UsedObjects;
+        };
+
+        /**
+         * Allocates and initializes a new slab and adds it to the list of slabs with free objects.
+         *
+         * @return the new slab or nullptr if the heap is out of memory
+         */
+        SlabHeader* CreateSlab() noexcept;
+
+        /**
+         * Adds a slab to the given list.
+         *
+         * @param list m_partialSlabs or m_fullSlabs
+         * @param slab slab to add
+         */
+        static void LinkSlab(SlabHeader*& list, SlabHeader* slab) noexcept;
+
+        /**
+         * Removes a slab from the given list.
+         *
+         * @param list list that contains the slab
+         * @param slab slab to remove
+         */
+        static void UnlinkSlab(SlabHeader*& list, SlabHeader* slab) noexcept;
+
+        /**
+         * Gives all slabs of the given list back to the heap.
+         *
+         * @param list list of slabs to free
+         */
+        static void FreeSlabs(SlabHeader* list) noexcept;
+
+       private:
+        size_t m_objectSize;
+        size_t m_firstObjectOffset;
+        size_t m_objectsPerSlab;
+        SlabHeader* m_partialSlabs;
+        SlabHeader* m_fullSlabs;
+        size_t m_emptySlabs;
+        size_t m_slabCount;
+    };
+
+    namespace _Internal {
+        /**
+         * Gets a SlabCache shared by all objects of the given size and alignment. The cache is never destroyed, objects
+         * owned by other static objects may be freed to it at any point of the program.
+         */
+        template <size_t Size, size_t Alignment>
+        SlabCache& GetSharedSlabCache();
+    }  // namespace _Internal
+
+    /**
+     * Typed front-end of a SlabCache.
+     *
+     * All types that have the same size (rounded up to a pointer size) and alignment share the same SlabCache. Types
+     * bigger than SlabCache::MAXIMUM_OBJECT_SIZE are allocated directly on the heap.
+     *
+     * @tparam T type of the cached objects
+     */
+    template <typename T>
+    class ObjectCache {
+       public:
+        /**
+         * Whether or not the objects are allocated from a SlabCache.
+         */
+        static constexpr const bool USES_SLABS = sizeof(T) <= SlabCache::MAXIMUM_OBJECT_SIZE;
+
+        /**
+         * Allocates memory for a single T, without constructing it.
+         *
+         * @return the allocated memory or nullptr if the heap is out of memory
+         */
+        [[nodiscard]] static void* Allocate() noexcept;
+
+        /**
+         * Frees memory previously allocated by Allocate, without destructing anything.
+         *
+         * @param object memory to free, may be nullptr
+         */
+        static void Free(void* object) noexcept;
+
+        /**
+         * Allocates and constructs a new T.
+         *
+         * @param args arguments passed to the constructor of T
+         * @return the new object, never nullptr
+         */
+        template <typename... Args>
+        [[nodiscard]] static T* New(Args&&... args);
+
+        /**
+         * Destructs and frees an object previously created by New.
+         *
+         * @param object object to delete, may be nullptr
+         */
+        static void Delete(T* object) noexcept;
+
+        /**
+         * Gets the SlabCache used by this ObjectCache. Only available if USES_SLABS is true.
+         *
+         * @return the underlying SlabCache
+         */
+        static SlabCache& GetSlabCache() noexcept;
+    };
+
+}  // namespace FunnyOS::Stdlib
+
+/**
+ * Makes all new and delete expressions of the given type use its ObjectCache. Placement new is still available.
+ * Must be placed inside the type definition.
+ */
+#define F_USE_OBJECT_CACHE(type)                                                                                       \
+    static void* operator new(FunnyOS::Stdlib::size_t size) {                                                          \
+        F_ASSERT(size == sizeof(type), "object cache used for a different type");                                     \
+        void* memory = FunnyOS::Stdlib::ObjectCache<type>::Allocate();                                                 \
+        if (memory == nullptr) {                                                                                       \
+            F_ERROR(FunnyOS::Stdlib::System::BadAllocation);                                                           \
+        }                                                                                                              \
+        return memory;                                                                                                 \
+    }                                                                                                                  \
+                                                                                                                       \
+    static void* operator new(FunnyOS::Stdlib::size_t /*unused*/, void* ptr) noexcept {                               \
+        return ptr;                                                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static void operator delete(void* ptr) noexcept {                                                                  \
+        FunnyOS::Stdlib::ObjectCache<type>::Free(ptr);                                                                 \
+    }
+
+#include "ObjectCache.tcc"
+#endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_HPP
@@ -0,0 +1,93 @@
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_TCC
+#define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_TCC
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_HPP
+#error "Include ObjectCache.hpp instead"
+#endif
+
+#include "Memory.hpp"
+#include "New.hpp"
+#include "Utility.hpp"
+
+namespace FunnyOS::Stdlib {
+    namespace _Internal {
+        constexpr size_t AlignObjectCacheSize(size_t size, size_t alignment) {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        constexpr size_t GetObjectCacheAlignment(size_t alignment) {
+            return alignment < alignof(void*) ? alignof(void*) : alignment;
+        }
+
+        template <size_t Size, size_t Alignment>
+        SlabCache& GetSharedSlabCache() {
+            alignas(SlabCache) static uint8_t c_storage[sizeof(SlabCache)];
+            static SlabCache* c_cache = ::new (c_storage) SlabCache{Size, Alignment};
+            return *c_cache;
+        }
+    }  // namespace _Internal
+
+    constexpr SlabCache::SlabCache(size_t objectSize, size_t objectAlignment) noexcept
+        : m_objectSize{0},
+          m_firstObjectOffset{0},
+          m_objectsPerSlab{0},
+          m_partialSlabs{nullptr},
+          m_fullSlabs{nullptr},
+          m_emptySlabs{0},
+          m_slabCount{0} {
+        const size_t alignment = _Internal::GetObjectCacheAlignment(objectAlignment);
+        const size_t size      = objectSize < sizeof(void*) ? sizeof(void*) : objectSize;
+
+        m_objectSize        = _Internal::AlignObjectCacheSize(size, alignment);
+        m_firstObjectOffset = _Internal::AlignObjectCacheSize(sizeof(SlabHeader), alignment);
+        m_objectsPerSlab    = (SLAB_SIZE - m_firstObjectOffset) / m_objectSize;
+    }
+
+    template <typename T>
+    void* ObjectCache<T>::Allocate() noexcept {
+        if constexpr (USES_SLABS) {
+            return GetSlabCache().Allocate();
+        } else {
+            return Memory::AllocateAligned(sizeof(T), alignof(T));
+        }
+    }
+
+    template <typename T>
+    void ObjectCache<T>::Free(void* object) noexcept {
+        if constexpr (USES_SLABS) {
+            GetSlabCache().Free(object);
+        } else {
+            Memory::Free(object);
+        }
+    }
+
+    template <typename T>
+    template <typename... Args>
+    T* ObjectCache<T>::New(Args&&... args) {
+        void* memory = Allocate();
+        if (memory == nullptr) {
+            F_ERROR(System::BadAllocation);
+        }
+
+        return ::new (memory) T(Forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void ObjectCache<T>::Delete(T* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+
+        object->~T();
+        Free(object);
+    }
+
+    template <typename T>
+    SlabCache& ObjectCache<T>::GetSlabCache() noexcept {
+        static_assert(USES_SLABS, "type too big for a slab cache");
+
+        constexpr size_t alignment = _Internal::GetObjectCacheAlignment(alignof(T));
+        return _Internal::GetSharedSlabCache<_Internal::AlignObjectCacheSize(sizeof(T), alignment), alignment>();
+    }
+}  // namespace FunnyOS::Stdlib
+
+#endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_OBJECTCACHE_TCC
@@ -0,0 +1,187 @@
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_HPP
+#define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_HPP
+
+#include "Functional.hpp"
+#include "Hash.hpp"
+#include "IntegerTypes.hpp"
+#include "String.hpp"
+#include "System.hpp"
+
+namespace FunnyOS::Stdlib {
+
+    /**
+     * Exception thrown when the accessed index of a string is greater than the maximum allowed.
+     */
+    F_TRIVIAL_EXCEPTION_WITH_MESSAGE(StringIndexOutOfBounds);
+
+    /**
+     * A non-owning view of a sequence of characters, a pointer and a length.
+     *
+     * The characters are not necessarily terminated by a null character and must outlive the view. Views are cheap to
+     * copy and should be passed by value.
+     */
+    template <typename T>
+    class BasicStringView {
+       public:
+        /**
+         * Type used to iterate over this view.
+         */
+        using Iterator = const T*;
+
+        /**
+         * A const type used to iterate over this view.
+         */
+        using ConstIterator = const T*;
+
+        /**
+         * Returned by the search functions when nothing was found.
+         */
+        constexpr const static size_t NOT_FOUND = ~static_cast<size_t>(0);
+
+       public:
+        TRIVIALLY_COPYABLE(BasicStringView);
+        TRIVIALLY_MOVEABLE(BasicStringView);
+
+        /**
+         * Constructs an empty view.
+         */
+        constexpr BasicStringView() noexcept;
+
+        /**
+         * Constructs a view of a null-terminated string, without the terminator.
+         *
+         * @param[in] string string to view, must be terminated by a null character
+         */
+        BasicStringView(const T* string) noexcept;
+
+        /**
+         * Constructs a view of [size] characters starting at [data].
+         *
+         * @param[in] data characters to view
+         * @param size amount of characters
+         */
+        constexpr BasicStringView(const T* data, size_t size) noexcept;
+
+        /**
+         * Gets the amount of characters in the view.
+         *
+         * @return size of the view
+         */
+        [[nodiscard]] constexpr size_t Size() const noexcept;
+
+        /**
+         * Checks whether or not the view has no characters.
+         *
+         * @return whether or not the view is empty
+         */
+        [[nodiscard]] constexpr bool IsEmpty() const noexcept;
+
+        /**
+         * Gets the viewed characters, they are not necessarily terminated by a null character.
+         *
+         * @return pointer to the first character
+         */
+        [[nodiscard]] constexpr const T* Data() const noexcept;
+
+        /**
+         * Gets the character at N'th index of the view
+         *
+         * @param index index
+         * @return the N'th character
+         *
+         * @throws StringIndexOutOfBounds when index >= Size()
+         */
+        [[nodiscard]] const T& operator[](size_t index) const;
+
+        /**
+         * Gets a view of a part of this view.
+         *
+         * @param offset index of the first character of the part
+         * @param length maximum amount of characters in the part, limited to the characters after [offset]
+         * @return view of the part
+         *
+         * @throws StringIndexOutOfBounds when offset > Size()
+         */
+        [[nodiscard]] BasicStringView Substring(size_t offset, size_t length = NOT_FOUND) const;
+
+        /**
+         * Finds the first occurrence of a character.
+         *
+         * @param character character to find
+         * @return index of the character or NOT_FOUND
+         */
+        [[nodiscard]] size_t IndexOf(T character) const noexcept;
+
+        /**
+         * Finds the last occurrence of a character.
+         *
+         * @param character character to find
+         * @return index of the character or NOT_FOUND
+         */
+        [[nodiscard]] size_t LastIndexOf(T character) const noexcept;
+
+        /**
+         * Checks whether or not the view starts with [prefix].
+         */
+        [[nodiscard]] bool StartsWith(BasicStringView prefix) const noexcept;
+
+        /**
+         * Checks whether or not the view ends with [suffix].
+         */
+        [[nodiscard]] bool EndsWith(BasicStringView suffix) const noexcept;
+
+        /**
+         * Gets a view without any leading and trailing whitespace.
+         *
+         * @return the trimmed view
+         */
+        [[nodiscard]] BasicStringView Trim() const noexcept;
+
+        /**
+         * Gets a view without any number of leading and trailing consecutive characters that match any character in
+         * [characterSet].
+         *
+         * @param[in] characterSet characters to be removed
+         * @return the trimmed view
+         */
+        [[nodiscard]] BasicStringView Trim(const char* characterSet) const noexcept;
+
+        bool operator==(BasicStringView other) const noexcept;
+
+        bool operator!=(BasicStringView other) const noexcept;
+
+        /**
+         * Returns an iterator pointing at the beginning of the view.
+         *
+         * @return iterator pointing at the beginning of the view.
+         */
+        ConstIterator Begin() const noexcept;
+
+        /**
+         * Returns an iterator pointing at the end of the view. (The character 1 after the last character of the view)
+         *
+         * @return iterator pointing at the end of the view.
+         */
+        ConstIterator End() const noexcept;
+
+        HAS_STANDARD_ITERATORS;
+
+       private:
+        const T* m_data;
+        size_t m_size;
+    };
+
+    /**
+     * Hashes the characters of a view, equal to the hash of a BasicDynamicString with the same characters.
+     */
+    template <typename T>
+    struct Hash<BasicStringView<T>> {
+        hash_t operator()(const BasicStringView<T>& obj);
+    };
+
+    using StringView = BasicStringView<char>;
+
+}  // namespace FunnyOS::Stdlib
+
+#include "StringView.tcc"
+#endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_HPP
@@ -0,0 +1,142 @@
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_HPP
+#error "Include StringView.hpp instead"
+#endif
+
+#ifndef FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_TCC
+#define FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_TCC
+#include "Algorithm.hpp"
+
+namespace FunnyOS::Stdlib {
+
+    template <typename T>
+    constexpr BasicStringView<T>::BasicStringView() noexcept : m_data{nullptr}, m_size{0} {}
+
+    template <typename T>
+    BasicStringView<T>::BasicStringView(const T* string) noexcept : m_data{string}, m_size{String::Length(string)} {}
+
+    template <typename T>
+    constexpr BasicStringView<T>::BasicStringView(const T* data, size_t size) noexcept : m_data{data}, m_size{size} {}
+
+    template <typename T>
+    constexpr size_t BasicStringView<T>::Size() const noexcept {
+        return m_size;
+    }
+
+    template <typename T>
+    constexpr bool BasicStringView<T>::IsEmpty() const noexcept {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    constexpr const T* BasicStringView<T>::Data() const noexcept {
+        return m_data;
+    }
+
+    template <typename T>
+    const T& BasicStringView<T>::operator[](size_t index) const {
+        if (index >= m_size) {
+            F_ERROR_WITH_MESSAGE(StringIndexOutOfBounds, "string view index out of bounds");
+        }
+
+        return m_data[index];
+    }
+
+    template <typename T>
+    BasicStringView<T> BasicStringView<T>::Substring(size_t offset, size_t length) const {
+        if (offset > m_size) {
+            F_ERROR_WITH_MESSAGE(StringIndexOutOfBounds, "substring offset out of bounds");
+        }
+
+        return BasicStringView{m_data + offset, Min(length, m_size - offset)};
+    }
+
+    template <typename T>
+    size_t BasicStringView<T>::IndexOf(T character) const noexcept {
+        for (size_t i = 0; i < m_size; i++) {
+            if (m_data[i] == character) {
+                return i;
+            }
+        }
+
+        return NOT_FOUND;
+    }
+
+    template <typename T>
+    size_t BasicStringView<T>::LastIndexOf(T character) const noexcept {
+        for (size_t i = m_size; i > 0; i--) {
+            if (m_data[i - 1] == character) {
+                return i - 1;
+            }
+        }
+
+        return NOT_FOUND;
+    }
+
+    template <typename T>
+    bool BasicStringView<T>::StartsWith(BasicStringView prefix) const noexcept {
+        return prefix.m_size <= m_size && BasicStringView{m_data, prefix.m_size} == prefix;
+    }
+
+    template <typename T>
+    bool BasicStringView<T>::EndsWith(BasicStringView suffix) const noexcept {
+        return suffix.m_size <= m_size && BasicStringView{m_data + m_size - suffix.m_size, suffix.m_size} == suffix;
+    }
+
+    template <typename T>
+    BasicStringView<T> BasicStringView<T>::Trim() const noexcept {
+        return Trim(String::DefaultWhitespaceList);
+    }
+
+    template <typename T>
+    BasicStringView<T> BasicStringView<T>::Trim(const char* characterSet) const noexcept {
+        size_t start = 0;
+        while (start < m_size && String::Matches(m_data[start], characterSet)) {
+            start++;
+        }
+
+        size_t end = m_size;
+        while (end > start && String::Matches(m_data[end - 1], characterSet)) {
+            end--;
+        }
+
+        return BasicStringView{m_data + start, end - start};
+    }
+
+    template <typename T>
+    bool BasicStringView<T>::operator==(BasicStringView other) const noexcept {
+        if (m_size != other.m_size) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_size; i++) {
+            if (m_data[i] != other.m_data[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool BasicStringView<T>::operator!=(BasicStringView other) const noexcept {
+        return !(*this == other);
+    }
+
+    template <typename T>
+    typename BasicStringView<T>::ConstIterator BasicStringView<T>::Begin() const noexcept {
+        return m_data;
+    }
+
+    template <typename T>
+    typename BasicStringView<T>::ConstIterator BasicStringView<T>::End() const noexcept {
+        return m_data + m_size;
+    }
+
+    template <typename T>
+    hash_t Hash<BasicStringView<T>>::operator()(const BasicStringView<T>& obj) {
+        return HashBytes(obj.Data(), obj.Size() * sizeof(T));
+    }
+
+}  // namespace FunnyOS::Stdlib
+
+#endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_STRINGVIEW_TCC
@@ -53,6 +53,14 @@
         }                            \
     } while (0)
 
+// For noexcept functions, where a thrown AssertionFailure would only reach std::terminate
+#define F_ASSERT_NOEXCEPT(condition, message)            \
+    do {                                                 \
+        if (!(condition)) {                              \
+            FunnyOS::Stdlib::System::Terminate(message); \
+        }                                                \
+    } while (0)
+
 //
 // Exception macros
 //
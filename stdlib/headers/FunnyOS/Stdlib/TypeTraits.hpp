@@ -148,6 +148,32 @@ namespace FunnyOS::Stdlib {
      template <typename T>
     constexpr bool IsVoid = IsSame<RemoveCV<T>, void>;
 
+    /**
+     * Check if T can be copied by copying its bytes
+     *
+     * @param T type to check
+     */
+    template <typename T>
+    constexpr bool IsTriviallyCopyable = __is_trivially_copyable(T);
+
+    /**
+     * Check if equal values of T always have equal bytes
+     *
+     * @param T type to check
+     */
+    template <typename T>
+    constexpr bool HasUniqueObjectRepresentations = __has_unique_object_representations(T);
+
+    /**
+     * Check if T can be moved to another address by copying its bytes and forgetting the original, without calling
+     * its move constructor and destructor. Types that are not trivially copyable, but do not point into themselves,
+     * opt in by specializing this variable.
+     *
+     * @param T type to check
+     */
+    template <typename T>
+    constexpr bool IsTriviallyRelocatable = IsTriviallyCopyable<T>;
+
 }  // namespace FunnyOS::Stdlib
 // clang-format on
 
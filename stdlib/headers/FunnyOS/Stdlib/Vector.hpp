@@ -5,6 +5,7 @@
 #include "IntegerTypes.hpp"
 #include "Functional.hpp"
 #include "Memory.hpp"
+#include "Algorithm.hpp"
 
 namespace FunnyOS::Stdlib {
 
@@ -18,14 +19,34 @@ namespace FunnyOS::Stdlib {
      */
     F_TRIVIAL_EXCEPTION_WITH_MESSAGE(VectorNotEnoughMemory);
 
+    namespace _Internal {
+        /**
+         * Uninitialized memory for the inline elements of a vector.
+         */
+        template <typename T, size_t N>
+        struct alignas(T) VectorInlineStorage {
+            uint8_t Data[N * sizeof(T)];
+        };
+
+        template <typename T>
+        struct VectorInlineStorage<T, 0> {};
+    }  // namespace _Internal
+
     /**
      * A dynamic-size container of values stored on heap.
      * The elements are guaranteed to be placed in memory next to each other in an ascending order of indexes.
      * Random access of a vector's element is guaranteed to be O(1)
      *
+     * A vector with a non-zero [N] keeps up to [N] elements inside itself and only uses the heap when it grows beyond
+     * that, see InlineVector.
+     *
+     * Elements of trivially relocatable types (see IsTriviallyRelocatable) are moved in bulk when the vector grows or
+     * when elements are inserted and removed, other types are moved one at a time with their move constructors.
+     *
      * @tparam T type of the elements.
+     * @tparam N amount of elements stored inside the vector itself.
      */
-    template <typename T>
+    template <typename T, size_t N = 0>
     class Vector {
        public:
 #ifdef F_LL
@@ -203,6 +224,15 @@ namespace FunnyOS::Stdlib {
          */
         Iterator Erase(ConstIterator iterator);
 
+        /**
+         * Removes every element that matches the predicate [matcher], in a single pass over the vector.
+         *
+         * @param matcher matcher to test elements
+         * @return number of elements removed
+         */
+        template <typename Matcher>
+        size_t RemoveIf(Matcher matcher);
+
         /**
          * Resizes the vector's heap to match the size of the vector.
          */
@@ -313,7 +343,33 @@ namespace FunnyOS::Stdlib {
         HAS_STANDARD_ITERATORS;
 
        private:
-        static void VectorMove(Memory::SizedBuffer<T>& destination, T* source) noexcept;
+        /**
+         * Moves [count] elements from [source] to the uninitialized memory at [destination], leaving [source]
+         * uninitialized. The ranges may overlap.
+         */
+        static void Relocate(T* destination, T* source, size_t count) noexcept;
+
+        /**
+         * Changes the capacity of the heap, relocating all the elements.
+         *
+         * @return whether or not the memory could be allocated, the vector is left empty and without a heap if not
+         */
+        bool ReallocateStorage(size_t capacity) noexcept;
+
+        /**
+         * Checks whether or not the elements are currently stored inside the vector.
+         */
+        [[nodiscard]] bool IsInline() const noexcept;
+
+        /**
+         * Gets the inline storage, or an empty buffer if the vector has none.
+         */
+        [[nodiscard]] Memory::SizedBuffer<T> GetInlineBuffer() noexcept;
+
+        /**
+         * Frees the heap, unless the elements are stored inline.
+         */
+        void FreeHeap() noexcept;
 
         void CheckBounds(size_t index) const;
 
@@ -321,16 +377,37 @@ namespace FunnyOS::Stdlib {
 
         void EnsureCapacityExact(size_t num);
 
-       private:
-        template <typename>
-        friend class BasicDynamicString;
-
        private:
         growth_factor_t m_growthFactor{DEFAULT_GROWTH_FACTOR};
         size_t m_size{0};
         Memory::SizedBuffer<T> m_data;
+        [[no_unique_address]] _Internal::VectorInlineStorage<T, N> m_inlineStorage;
     };
 
+    /**
+     * A vector that keeps up to [N] elements inside itself, so small vectors do not allocate any memory. It only uses
+     * the heap when it grows beyond [N] elements, and goes back to the inline storage when shrunk.
+     *
+     * @tparam T type of the elements.
+     * @tparam N amount of elements stored inside the vector itself.
+     */
+    template <typename T, size_t N>
+    using InlineVector = Vector<T, N>;
+
+    /**
+     * The elements are on the heap, so a vector can be moved by copying its bytes.
+     */
+    template <typename T>
+    constexpr bool IsTriviallyRelocatable<Vector<T>> = true;
+
+    /**
+     * Removes every element of the vector that matches the predicate [matcher], see Vector::RemoveIf.
+     *
+     * @return number of elements removed
+     */
+    template <typename T, size_t N, typename Matcher>
+    size_t RemoveIf(Vector<T, N>& vector, Matcher matcher);
+
 }  // namespace FunnyOS::Stdlib
 
 #include "Vector.tcc"
@@ -12,8 +12,8 @@
 
 namespace FunnyOS::Stdlib {
 
-    template <typename T>
-    Vector<T>::Vector(const Vector& other) : m_growthFactor(other.m_growthFactor), m_data({nullptr, 0}) {
+    template <typename T, size_t N>
+    Vector<T, N>::Vector(const Vector& other) : m_growthFactor(other.m_growthFactor), m_data(GetInlineBuffer()) {
         EnsureCapacityExact(other.Size());
 
         for (auto const& element : other) {
@@ -21,8 +21,8 @@ namespace FunnyOS::Stdlib {
         }
     }
 
-    template <typename T>
-    Vector<T>& Vector<T>::operator=(const Vector& other) {
+    template <typename T, size_t N>
+    Vector<T, N>& Vector<T, N>::operator=(const Vector& other) {
         if (&other == this) {
             return *this;
         }
@@ -37,136 +37,157 @@ namespace FunnyOS::Stdlib {
         return *this;
     }
 
-    template <typename T>
-    Vector<T>::Vector(Vector&& other) noexcept
+    template <typename T, size_t N>
+    Vector<T, N>::Vector(Vector&& other) noexcept
         : m_growthFactor(other.m_growthFactor), m_size(other.m_size), m_data(other.m_data) {
-        other.m_data.Data = nullptr;
+        if constexpr (N != 0) {
+            // Inline elements cannot be stolen, only moved one by one
+            if (other.IsInline()) {
+                m_data = GetInlineBuffer();
+                Relocate(m_data.Data, other.m_data.Data, m_size);
+            }
+
+            other.m_data = other.GetInlineBuffer();
+            other.m_size = 0;
+        } else {
+            other.m_data.Data = nullptr;
+        }
     }
 
-    template <typename T>
-    Vector<T>& Vector<T>::operator=(Vector&& other) noexcept {
+    template <typename T, size_t N>
+    Vector<T, N>& Vector<T, N>::operator=(Vector&& other) noexcept {
         Clear();
-        Memory::FreeBuffer(m_data);
+        FreeHeap();
 
         m_growthFactor = other.m_growthFactor;
-        m_size = other.m_size;
-        m_data = other.m_data;
+        m_size         = other.m_size;
+        m_data         = other.m_data;
+
+        if constexpr (N != 0) {
+            if (other.IsInline()) {
+                m_data = GetInlineBuffer();
+                Relocate(m_data.Data, other.m_data.Data, m_size);
+            }
+
+            other.m_data = other.GetInlineBuffer();
+            other.m_size = 0;
+        } else {
+            other.m_data.Data = nullptr;
+        }
 
-        other.m_data.Data = nullptr;
         return *this;
     }
 
-    template <typename T>
-    Vector<T>::Vector() : Vector(0) {}
+    template <typename T, size_t N>
+    Vector<T, N>::Vector() : Vector(0) {}
 
-    template <typename T>
-    Vector<T>::Vector(size_t initialCapacity) : Vector(initialCapacity, DEFAULT_GROWTH_FACTOR) {}
+    template <typename T, size_t N>
+    Vector<T, N>::Vector(size_t initialCapacity) : Vector(initialCapacity, DEFAULT_GROWTH_FACTOR) {}
 
-    template <typename T>
-    Vector<T>::Vector(size_t initialCapacity, growth_factor_t growthFactor)
-        : m_growthFactor(growthFactor), m_data({nullptr, 0}) {
+    template <typename T, size_t N>
+    Vector<T, N>::Vector(size_t initialCapacity, growth_factor_t growthFactor)
+        : m_growthFactor(growthFactor), m_data(GetInlineBuffer()) {
         F_ASSERT(m_growthFactor > 1, "vector's growth factor too small");
 
         EnsureCapacityExact(initialCapacity);
     }
 
-    template <typename T>
-    Vector<T>::Vector(InitializerList<T> list) : Vector(SizeOf(list), DEFAULT_GROWTH_FACTOR) {
+    template <typename T, size_t N>
+    Vector<T, N>::Vector(InitializerList<T> list) : Vector(SizeOf(list), DEFAULT_GROWTH_FACTOR) {
         for (auto& ref : list) {
             Append(ref);
         }
     }
 
-    template <typename T>
-    Vector<T>::~Vector() {
+    template <typename T, size_t N>
+    Vector<T, N>::~Vector() {
         if (m_data.Data != nullptr) {
             Clear();
-            Memory::FreeBuffer(m_data);
+            FreeHeap();
         }
     }
 
-    template <typename T>
-    size_t Vector<T>::Size() const noexcept {
+    template <typename T, size_t N>
+    size_t Vector<T, N>::Size() const noexcept {
         return m_size;
     }
 
-    template <typename T>
-    size_t Vector<T>::Capacity() const noexcept {
+    template <typename T, size_t N>
+    size_t Vector<T, N>::Capacity() const noexcept {
         return m_data.Size;
     }
 
-    template <typename T>
-    T& Vector<T>::operator[](size_t index) {
+    template <typename T, size_t N>
+    T& Vector<T, N>::operator[](size_t index) {
         CheckBounds(index);
         return m_data.Data[index];
     }
 
-    template <typename T>
-    const T& Vector<T>::operator[](size_t index) const {
+    template <typename T, size_t N>
+    const T& Vector<T, N>::operator[](size_t index) const {
         CheckBounds(index);
         return m_data.Data[index];
     }
 
-    template <typename T>
-    T& Vector<T>::Head() {
+    template <typename T, size_t N>
+    T& Vector<T, N>::Head() {
         CheckBounds(0);
         return m_data.Data[0];
     }
 
-    template <typename T>
-    T& Vector<T>::Tail() {
+    template <typename T, size_t N>
+    T& Vector<T, N>::Tail() {
         CheckBounds(0);
         return m_data.Data[m_size - 1];
     }
 
-    template <typename T>
-    const T& Vector<T>::Head() const {
+    template <typename T, size_t N>
+    const T& Vector<T, N>::Head() const {
         CheckBounds(0);
         return m_data.Data[0];
     }
 
-    template <typename T>
-    const T& Vector<T>::Tail() const {
+    template <typename T, size_t N>
+    const T& Vector<T, N>::Tail() const {
         CheckBounds(0);
         return m_data.Data[m_size - 1];
     }
 
-    template <typename T>
-    void Vector<T>::Append(const T& value) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Append(const T& value) {
         EnsureCapacity(m_size + 1);
         new (m_data[m_size]) T(value);
         m_size++;
     }
 
-    template <typename T>
-    void Vector<T>::Append(T&& value) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Append(T&& value) {
         EnsureCapacity(m_size + 1);
         new (m_data[m_size]) T(Forward<T&&>(value));
         m_size++;
     }
 
-    template <typename T>
+    template <typename T, size_t N>
     template <typename... Args>
-    T& Vector<T>::AppendInPlace(Args&&... args) {
+    T& Vector<T, N>::AppendInPlace(Args&&... args) {
         EnsureCapacity(m_size + 1);
         new (m_data[m_size]) T(Forward<Args>(args)...);
         m_size++;
         return m_data.Data[m_size - 1];
     }
 
-    template <typename T>
-    void Vector<T>::Remove(size_t index) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Remove(size_t index) {
         CheckBounds(index);
 
         m_data[index]->~T();
 
-        Memory::SizedBuffer<T> destination{m_data.Data + index, m_size - index - 1};
-        VectorMove(destination, m_data.Data + index + 1);
+        Relocate(m_data.Data + index, m_data.Data + index + 1, m_size - index - 1);
         m_size--;
     }
 
-    template <typename T>
-    void Vector<T>::RemoveRange(size_t from, size_t to) {
+    template <typename T, size_t N>
+    void Vector<T, N>::RemoveRange(size_t from, size_t to) {
         CheckBounds(from);
         CheckBounds(to);
 
@@ -178,35 +199,45 @@ namespace FunnyOS::Stdlib {
             m_data[i]->~T();
         }
 
-        Memory::SizedBuffer<T> destination{m_data.Data + from, m_size - to - 1};
-        VectorMove(destination, m_data.Data + to + 1);
+        Relocate(m_data.Data + from, m_data.Data + to + 1, m_size - to - 1);
 
         m_size -= to - from + 1;
     }
 
-    template <typename T>
-    typename Vector<T>::Iterator Vector<T>::Erase(Vector<T>::ConstIterator iterator) {
-        for (size_t i = 0; i < m_size; i++) {
-            if (m_data.Data + i == iterator) {
-                Remove(i);
-                return m_data.Data + i;
-            }
+    template <typename T, size_t N>
+    typename Vector<T, N>::Iterator Vector<T, N>::Erase(Vector<T, N>::ConstIterator iterator) {
+        if (iterator < m_data.Data || iterator >= m_data.Data + m_size) {
+            return End();
         }
 
-        return End();
+        const auto index = static_cast<size_t>(iterator - m_data.Data);
+        Remove(index);
+        return m_data.Data + index;
     }
 
-    template <typename T>
-    void Vector<T>::ShrinkToSize() {
-        Memory::ReallocateBuffer(m_data, m_size);
+    template <typename T, size_t N>
+    template <typename Matcher>
+    size_t Vector<T, N>::RemoveIf(Matcher matcher) {
+        Iterator newEnd     = Compact(Begin(), End(), matcher);
+        const size_t erased = static_cast<size_t>(End() - newEnd);
 
-        if (m_data.Data == nullptr) {
+        for (Iterator current = newEnd; current != End(); current++) {
+            current->~T();
+        }
+
+        m_size -= erased;
+        return erased;
+    }
+
+    template <typename T, size_t N>
+    void Vector<T, N>::ShrinkToSize() {
+        if (!ReallocateStorage(m_size)) {
             F_ERROR_WITH_MESSAGE(VectorNotEnoughMemory, "vector could not allocate enough memory while shrinking");
         }
     }
 
-    template <typename T>
-    void Vector<T>::EnsureCapacity(size_t num) {
+    template <typename T, size_t N>
+    void Vector<T, N>::EnsureCapacity(size_t num) {
         if (m_data.Size >= num) {
             return;
         }
@@ -219,25 +250,25 @@ namespace FunnyOS::Stdlib {
         EnsureCapacityExact(desiredCapacity);
     }
 
-    template <typename T>
-    void Vector<T>::Insert(size_t index, const T& value) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Insert(size_t index, const T& value) {
         EnsureCapacity(m_size + 1);
         Shift(index, 1);
         new (m_data.Data + index) T(value);
         m_size++;
     }
 
-    template <typename T>
-    void Vector<T>::Insert(size_t index, T&& value) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Insert(size_t index, T&& value) {
         EnsureCapacity(m_size + 1);
         Shift(index, 1);
-        new (m_data.Data + index) T(value);
+        new (m_data.Data + index) T(Forward<T&&>(value));
         m_size++;
     }
 
-    template <typename T>
+    template <typename T, size_t N>
     template <typename... Args>
-    T& Vector<T>::InsertInPlace(size_t index, Args&&... args) {
+    T& Vector<T, N>::InsertInPlace(size_t index, Args&&... args) {
         EnsureCapacity(m_size + 1);
         Shift(index, 1);
         new (m_data.Data + index) T(Forward<Args>(args)...);
@@ -245,22 +276,26 @@ namespace FunnyOS::Stdlib {
         return m_data.Data[index];
     }
 
-    template <typename T>
+    template <typename T, size_t N>
     template <class OtherIterator>
-    void Vector<T>::Insert(size_t index, OtherIterator value, size_t size) {
+    void Vector<T, N>::Insert(size_t index, OtherIterator value, size_t size) {
         EnsureCapacity(m_size + size);
         Shift(index, size);
 
-        for (size_t i = index; i < index + size; i++) {
-            new (m_data.Data + i) T(*value);
-            value++;
+        if constexpr (IsTriviallyCopyable<T> && (IsSame<OtherIterator, T*> || IsSame<OtherIterator, const T*>)) {
+            Memory::Copy(m_data.Data + index, value, size);
+        } else {
+            for (size_t i = index; i < index + size; i++) {
+                new (m_data.Data + i) T(*value);
+                value++;
+            }
         }
 
         m_size += size;
     }
 
-    template <typename T>
-    void Vector<T>::Clear() {
+    template <typename T, size_t N>
+    void Vector<T, N>::Clear() {
         for (size_t i = 0; i < m_size; i++) {
             (m_data.Data + i)->~T();
         }
@@ -268,71 +303,154 @@ namespace FunnyOS::Stdlib {
         m_size = 0;
     }
 
-    template<typename T>
-    Memory::SizedBuffer<T> Vector<T>::AsSizedBuffer() {
+    template <typename T, size_t N>
+    Memory::SizedBuffer<T> Vector<T, N>::AsSizedBuffer() {
         return Memory::SizedBuffer<T> { m_data.Data, m_size };
     }
 
-    template <typename T>
-    typename Vector<T>::Iterator Vector<T>::Begin() noexcept {
+    template <typename T, size_t N>
+    typename Vector<T, N>::Iterator Vector<T, N>::Begin() noexcept {
         return m_data.Data;
     }
 
-    template <typename T>
-    typename Vector<T>::Iterator Vector<T>::End() noexcept {
+    template <typename T, size_t N>
+    typename Vector<T, N>::Iterator Vector<T, N>::End() noexcept {
         return m_data.Data + m_size;
     }
 
-    template <typename T>
-    typename Vector<T>::ConstIterator Vector<T>::Begin() const noexcept {
+    template <typename T, size_t N>
+    typename Vector<T, N>::ConstIterator Vector<T, N>::Begin() const noexcept {
         return m_data.Data;
     }
 
-    template <typename T>
-    typename Vector<T>::ConstIterator Vector<T>::End() const noexcept {
+    template <typename T, size_t N>
+    typename Vector<T, N>::ConstIterator Vector<T, N>::End() const noexcept {
         return m_data.Data + m_size;
     }
 
-    template <typename T>
-    void Vector<T>::VectorMove(Memory::SizedBuffer<T>& destination, T* source) noexcept {
-        if (destination.Data < source) {
-            for (size_t i = 0; i < destination.Size; i++) {
-                destination.Data[i] = Forward<T&&>(source[i]);
+    template <typename T, size_t N>
+    void Vector<T, N>::Relocate(T* destination, T* source, size_t count) noexcept {
+        if constexpr (IsTriviallyRelocatable<T>) {
+            Memory::Move(destination, source, count * sizeof(T));
+        } else if (destination < source) {
+            for (size_t i = 0; i < count; i++) {
+                new (destination + i) T(Forward<T&&>(source[i]));
+                source[i].~T();
             }
-        } else if (destination.Data > source) {
-            for (ssize_t i = destination.Size - 1; i >= 0; i--) {
-                destination.Data[i] = Forward<T&&>(source[i]);
+        } else if (destination > source) {
+            for (size_t i = count; i > 0; i--) {
+                new (destination + i - 1) T(Forward<T&&>(source[i - 1]));
+                source[i - 1].~T();
             }
         }
     }
 
-    template <typename T>
-    void Vector<T>::CheckBounds(size_t index) const {
+    template <typename T, size_t N>
+    bool Vector<T, N>::ReallocateStorage(size_t capacity) noexcept {
+        if constexpr (N != 0) {
+            if (capacity <= N) {
+                // Everything fits inline again, the heap is not needed anymore
+                if (!IsInline()) {
+                    Memory::SizedBuffer<T> heap = m_data;
+                    m_data                      = GetInlineBuffer();
+                    Relocate(m_data.Data, heap.Data, m_size);
+                    Memory::FreeBuffer(heap);
+                }
+
+                return true;
+            }
+
+            if (IsInline()) {
+                Memory::SizedBuffer<T> data = Memory::AllocateBuffer<T>(capacity);
+                if (data.Data == nullptr) {
+                    Clear();
+                    return false;
+                }
+
+                Relocate(data.Data, m_data.Data, m_size);
+                m_data = data;
+                return true;
+            }
+        }
+
+        if constexpr (IsTriviallyRelocatable<T>) {
+            // The allocator can often grow the block in place, which needs no copy at all
+            Memory::ReallocateBuffer(m_data, capacity);
+        } else {
+            Memory::SizedBuffer<T> data = Memory::AllocateBuffer<T>(capacity);
+
+            if (data.Data != nullptr) {
+                Relocate(data.Data, m_data.Data, m_size);
+            } else {
+                Clear();
+            }
+
+            Memory::FreeBuffer(m_data);
+            m_data = data;
+        }
+
+        if (m_data.Data == nullptr) {
+            m_size = 0;
+            return false;
+        }
+
+        return true;
+    }
+
+    template <typename T, size_t N>
+    bool Vector<T, N>::IsInline() const noexcept {
+        if constexpr (N != 0) {
+            return m_data.Data == reinterpret_cast<const T*>(m_inlineStorage.Data);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename T, size_t N>
+    Memory::SizedBuffer<T> Vector<T, N>::GetInlineBuffer() noexcept {
+        if constexpr (N != 0) {
+            return {reinterpret_cast<T*>(m_inlineStorage.Data), N};
+        } else {
+            return {nullptr, 0};
+        }
+    }
+
+    template <typename T, size_t N>
+    void Vector<T, N>::FreeHeap() noexcept {
+        if (!IsInline()) {
+            Memory::FreeBuffer(m_data);
+        }
+    }
+
+    template <typename T, size_t N>
+    void Vector<T, N>::CheckBounds(size_t index) const {
         if (index >= m_size) {
             F_ERROR_WITH_MESSAGE(VectorIndexOutOfBounds, "vector index out of bounds");
         }
     }
 
-    template <typename T>
-    void Vector<T>::Shift(size_t index, size_t count) {
+    template <typename T, size_t N>
+    void Vector<T, N>::Shift(size_t index, size_t count) {
         if (count == 0 || index == m_size) {
             return;
         }
         CheckBounds(index);
 
-        Memory::SizedBuffer<T> destination{m_data.Data + index + count, m_size - index};
-        VectorMove(destination, m_data.Data + index);
+        Relocate(m_data.Data + index + count, m_data.Data + index, m_size - index);
     }
 
-    template <typename T>
-    void Vector<T>::EnsureCapacityExact(size_t desiredCapacity) {
-        Memory::ReallocateBuffer(m_data, desiredCapacity);
-
-        if (m_data.Data == nullptr) {
+    template <typename T, size_t N>
+    void Vector<T, N>::EnsureCapacityExact(size_t desiredCapacity) {
+        if (!ReallocateStorage(desiredCapacity)) {
             F_ERROR_WITH_MESSAGE(VectorNotEnoughMemory, "vector could not allocate enough memory");
         }
     }
 
+    template <typename T, size_t N, typename Matcher>
+    size_t RemoveIf(Vector<T, N>& vector, Matcher matcher) {
+        return vector.RemoveIf(matcher);
+    }
+
 }  // namespace FunnyOS::Stdlib
 
 #endif  // FUNNYOS_STDLIB_HEADERS_FUNNYOS_STDLIB_VECTOR_TCC
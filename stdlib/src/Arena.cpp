@@ -0,0 +1,321 @@
+#include <FunnyOS/Stdlib/Arena.hpp>
+
+#include <FunnyOS/Stdlib/Algorithm.hpp>
+#include <FunnyOS/Stdlib/Memory.hpp>
+#include <FunnyOS/Stdlib/Platform.hpp>
+
+namespace FunnyOS::Stdlib {
+    namespace {
+        /**
+         * Alignment of every chunk taken from the heap.
+         */
+        constexpr const size_t CHUNK_ALIGNMENT = 16;
+
+        /**
+         * Header present in front of every allocation.
+         */
+        struct AllocationHeader {
+            /**
+             * Arena that made the allocation.
+             */
+            Arena* Owner;
+
+            /**
+             * Size of the allocation, so it can be copied when reallocated.
+             */
+            size_t Size;
+
+            /**
+             * MakeTag of this allocation, lets FindOwner check that a pointer inside a chunk is an allocation.
+             */
+            uintptr_t Tag;
+        };
+
+        /**
+         * Mixed into every tag, so a tag is unlikely to match leftover data of a discarded allocation.
+         */
+        constexpr const uintptr_t TAG_KEY = 0x5A17E4A0C3B1D96F;
+
+        /**
+         * Memory of a single chunk of a live arena.
+         */
+        struct ChunkRange {
+            uintptr_t Start;
+            uintptr_t End;
+            Arena* Owner;
+        };
+
+        /**
+         * Memory of all chunks of all live arenas, sorted by address. It is allocated directly from the platform,
+         * so it never ends up in an arena.
+         */
+        ChunkRange* g_chunkRanges   = nullptr;
+        size_t g_chunkRangeCount    = 0;
+        size_t g_chunkRangeCapacity = 0;
+
+        /**
+         * Arena activated by the innermost ArenaScope.
+         */
+        Arena* g_activeArena = nullptr;
+
+        inline uintptr_t AlignUp(uintptr_t value, size_t alignment) {
+            return (value + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        }
+
+        inline AllocationHeader& GetAllocationHeader(void* ptr) {
+            return *(static_cast<AllocationHeader*>(ptr) - 1);
+        }
+
+        inline uintptr_t MakeTag(const void* ptr, const Arena* owner) {
+            return reinterpret_cast<uintptr_t>(ptr) ^ reinterpret_cast<uintptr_t>(owner) ^ TAG_KEY;
+        }
+
+        /**
+         * Gets the index of the first range that starts above [address].
+         */
+        size_t FindChunkRangeAbove(uintptr_t address) {
+            size_t low  = 0;
+            size_t high = g_chunkRangeCount;
+
+            while (low < high) {
+                const size_t middle = low + (high - low) / 2;
+
+                if (g_chunkRanges[middle].Start <= address) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            return low;
+        }
+
+        /**
+         * Gets the range of the chunk that contains [address] or nullptr if no chunk of a live arena does.
+         */
+        const ChunkRange* FindChunkRange(uintptr_t address) {
+            const size_t index = FindChunkRangeAbove(address);
+            if (index == 0) {
+                return nullptr;
+            }
+
+            const ChunkRange& range = g_chunkRanges[index - 1];
+            return address < range.End ? &range : nullptr;
+        }
+
+        /**
+         * Adds the memory of a new chunk to the registry.
+         *
+         * @return whether or not the registry could hold the chunk
+         */
+        bool RegisterChunkRange(uintptr_t start, uintptr_t end, Arena* owner) {
+            if (g_chunkRangeCount == g_chunkRangeCapacity) {
+                const size_t capacity = Max(g_chunkRangeCapacity * 2, static_cast<size_t>(16));
+                auto* ranges          = static_cast<ChunkRange*>(_Platform::ReallocateMemoryAligned(
+                    g_chunkRanges, capacity * sizeof(ChunkRange), alignof(ChunkRange)));
+                if (ranges == nullptr) {
+                    return false;
+                }
+
+                g_chunkRanges        = ranges;
+                g_chunkRangeCapacity = capacity;
+            }
+
+            const size_t index = FindChunkRangeAbove(start);
+            Memory::Move(
+                &g_chunkRanges[index + 1], &g_chunkRanges[index], (g_chunkRangeCount - index) * sizeof(ChunkRange));
+            g_chunkRanges[index] = {start, end, owner};
+            g_chunkRangeCount++;
+            return true;
+        }
+
+        /**
+         * Removes the memory of a chunk that is given back to the heap from the registry.
+         */
+        void UnregisterChunkRange(uintptr_t start) {
+            const size_t index = FindChunkRangeAbove(start) - 1;
+            F_ASSERT_NOEXCEPT(g_chunkRanges[index].Start == start, "unregistering an unknown chunk");
+
+            g_chunkRangeCount--;
+            Memory::Move(
+                &g_chunkRanges[index], &g_chunkRanges[index + 1], (g_chunkRangeCount - index) * sizeof(ChunkRange));
+
+            if (g_chunkRangeCount == 0) {
+                _Platform::FreeMemory(g_chunkRanges);
+                g_chunkRanges        = nullptr;
+                g_chunkRangeCapacity = 0;
+            }
+        }
+    }  // namespace
+
+    Arena::Arena(size_t chunkSize) noexcept
+        : m_chunkSize(chunkSize),
+          m_currentChunk(nullptr),
+          m_currentPosition(0),
+          m_currentEnd(0),
+          m_lastAllocation(nullptr) {}
+
+    Arena::~Arena() {
+        F_ASSERT_NOEXCEPT(g_activeArena != this, "arena destroyed while active");
+
+        while (m_currentChunk != nullptr) {
+            ChunkHeader* previous = m_currentChunk->Previous;
+            UnregisterChunkRange(reinterpret_cast<uintptr_t>(m_currentChunk + 1));
+            _Platform::FreeMemory(m_currentChunk);
+            m_currentChunk = previous;
+        }
+    }
+
+    void* Arena::Allocate(size_t size, size_t alignment) noexcept {
+        alignment = Max(alignment, alignof(AllocationHeader));
+
+        uintptr_t memory = AlignUp(m_currentPosition + sizeof(AllocationHeader), alignment);
+
+        if (m_currentChunk == nullptr || memory + size > m_currentEnd) {
+            if (!AddChunk(size, alignment)) {
+                return nullptr;
+            }
+
+            memory = AlignUp(m_currentPosition + sizeof(AllocationHeader), alignment);
+        }
+
+        void* ptr                = reinterpret_cast<void*>(memory);
+        AllocationHeader& header = GetAllocationHeader(ptr);
+        header.Owner             = this;
+        header.Size              = size;
+        header.Tag               = MakeTag(ptr, this);
+        m_currentPosition        = memory + size;
+        m_lastAllocation         = ptr;
+
+        return ptr;
+    }
+
+    void* Arena::Reallocate(void* ptr, size_t size, size_t alignment) noexcept {
+        const auto memory = reinterpret_cast<uintptr_t>(ptr);
+
+        // The most recent allocation can simply grow or shrink
+        if (ptr == m_lastAllocation && (memory % alignment) == 0 && memory + size <= m_currentEnd) {
+            GetAllocationHeader(ptr).Size = size;
+            m_currentPosition             = memory + size;
+            return ptr;
+        }
+
+        const size_t oldSize = GetAllocationHeader(ptr).Size;
+
+        void* newMemory = Allocate(size, alignment);
+        if (newMemory == nullptr) {
+            return nullptr;
+        }
+
+        Memory::Copy(newMemory, ptr, Min(oldSize, size));
+        return newMemory;
+    }
+
+    void Arena::Free(void* ptr) noexcept {
+        if (ptr == nullptr || ptr != m_lastAllocation) {
+            return;
+        }
+
+        m_currentPosition = reinterpret_cast<uintptr_t>(&GetAllocationHeader(ptr));
+        m_lastAllocation  = nullptr;
+    }
+
+    void Arena::Reset() noexcept {
+        if (m_currentChunk == nullptr) {
+            return;
+        }
+
+        while (m_currentChunk->Previous != nullptr) {
+            ChunkHeader* previous = m_currentChunk->Previous;
+            UnregisterChunkRange(reinterpret_cast<uintptr_t>(m_currentChunk + 1));
+            _Platform::FreeMemory(m_currentChunk);
+            m_currentChunk = previous;
+        }
+
+        UseChunk(m_currentChunk);
+    }
+
+    bool Arena::Owns(const void* ptr) const noexcept {
+        const auto address = reinterpret_cast<uintptr_t>(ptr);
+
+        for (const ChunkHeader* chunk = m_currentChunk; chunk != nullptr; chunk = chunk->Previous) {
+            const auto start = reinterpret_cast<uintptr_t>(chunk + 1);
+
+            if (address >= start && address < start + chunk->Size) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    size_t Arena::GetChunkCount() const noexcept {
+        size_t count = 0;
+
+        for (const ChunkHeader* chunk = m_currentChunk; chunk != nullptr; chunk = chunk->Previous) {
+            count++;
+        }
+
+        return count;
+    }
+
+    Arena* Arena::GetActive() noexcept {
+        return g_activeArena;
+    }
+
+    Arena* Arena::FindOwner(const void* ptr) noexcept {
+        const auto address      = reinterpret_cast<uintptr_t>(ptr);
+        const ChunkRange* range = FindChunkRange(address);
+
+        // Nothing in front of memory outside of the chunks is ever read, it may not even be mapped
+        if (range == nullptr || address - range->Start < sizeof(AllocationHeader)) {
+            return nullptr;
+        }
+
+        const AllocationHeader& header = *(static_cast<const AllocationHeader*>(ptr) - 1);
+        if (header.Owner != range->Owner || header.Tag != MakeTag(ptr, range->Owner)) {
+            return nullptr;
+        }
+
+        return range->Owner;
+    }
+
+    bool Arena::AddChunk(size_t size, size_t alignment) noexcept {
+        const size_t chunkSize = Max(m_chunkSize, size + sizeof(AllocationHeader) + alignment);
+
+        // Chunks are taken directly from the platform, so they never end up in another arena
+        auto* chunk = static_cast<ChunkHeader*>(
+            _Platform::AllocateMemoryAligned(sizeof(ChunkHeader) + chunkSize, CHUNK_ALIGNMENT));
+        if (chunk == nullptr) {
+            return false;
+        }
+
+        const auto start = reinterpret_cast<uintptr_t>(chunk + 1);
+        if (!RegisterChunkRange(start, start + chunkSize, this)) {
+            _Platform::FreeMemory(chunk);
+            return false;
+        }
+
+        chunk->Previous = m_currentChunk;
+        chunk->Size     = chunkSize;
+        UseChunk(chunk);
+
+        return true;
+    }
+
+    void Arena::UseChunk(ChunkHeader* chunk) noexcept {
+        m_currentChunk    = chunk;
+        m_currentPosition = reinterpret_cast<uintptr_t>(chunk + 1);
+        m_currentEnd      = m_currentPosition + chunk->Size;
+        m_lastAllocation  = nullptr;
+    }
+
+    ArenaScope::ArenaScope(Arena& arena) noexcept : m_previousActive(g_activeArena) {
+        g_activeArena = &arena;
+    }
+
+    ArenaScope::~ArenaScope() {
+        g_activeArena = m_previousActive;
+    }
+
+}  // namespace FunnyOS::Stdlib
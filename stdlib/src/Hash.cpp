@@ -0,0 +1,108 @@
+#include <FunnyOS/Stdlib/Hash.hpp>
+
+#include <FunnyOS/Stdlib/Compiler.hpp>
+
+namespace FunnyOS::Stdlib {
+    namespace {
+        /**
+         * Odd constants with balanced bits, from wyhash.
+         */
+        constexpr const uint64_t SECRET0 = 0xA0761D6478BD642F;
+        constexpr const uint64_t SECRET1 = 0xE7037ED1A0B428DB;
+        constexpr const uint64_t SECRET2 = 0x8EBC6AF09C88C6E3;
+        constexpr const uint64_t SECRET3 = 0x589965CC75374CC3;
+
+        typedef uint64_t UnalignedWord F_MAY_ALIAS F_UNALIGNED;
+        typedef uint32_t UnalignedHalfWord F_MAY_ALIAS F_UNALIGNED;
+
+        inline uint64_t Read64(const uint8_t* data) noexcept {
+            return *reinterpret_cast<const UnalignedWord*>(data);
+        }
+
+        inline uint64_t Read32(const uint8_t* data) noexcept {
+            return *reinterpret_cast<const UnalignedHalfWord*>(data);
+        }
+
+        /**
+         * Reads 1 to 3 bytes, every byte ends up in the result.
+         */
+        inline uint64_t ReadSmall(const uint8_t* data, size_t size) noexcept {
+            return (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[size / 2]) << 8) |
+                   data[size - 1];
+        }
+
+        /**
+         * Multiplies [a] and [b] to a 128-bit product, [a] gets its low half and [b] its high half.
+         */
+        inline void Multiply(uint64_t& a, uint64_t& b) noexcept {
+            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            a                               = static_cast<uint64_t>(product);
+            b                               = static_cast<uint64_t>(product >> 64);
+        }
+
+        /**
+         * Mixes two words to one, every bit of the result depends on every bit of both words.
+         */
+        inline uint64_t Mix(uint64_t a, uint64_t b) noexcept {
+            Multiply(a, b);
+            return a ^ b;
+        }
+    }  // namespace
+
+    hash_t HashBytes(const void* data, size_t size, hash_t seed) noexcept {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        uint64_t state    = seed ^ Mix(seed ^ SECRET0, SECRET1);
+        uint64_t a;
+        uint64_t b;
+
+        if (size <= 16) {
+            if (size >= 4) {
+                // Two overlapping pairs of 4 byte reads cover every size from 4 to 16
+                const size_t offset = (size / 8) * 4;
+                a                   = (Read32(bytes) << 32) | Read32(bytes + offset);
+                b                   = (Read32(bytes + size - 4) << 32) | Read32(bytes + size - 4 - offset);
+            } else if (size > 0) {
+                a = ReadSmall(bytes, size);
+                b = 0;
+            } else {
+                a = 0;
+                b = 0;
+            }
+        } else {
+            size_t remaining = size;
+
+            // Three independent lanes, so the multiplications of long inputs run in parallel
+            if (remaining > 48) {
+                uint64_t state1 = state;
+                uint64_t state2 = state;
+
+                do {
+                    state  = Mix(Read64(bytes) ^ SECRET1, Read64(bytes + 8) ^ state);
+                    state1 = Mix(Read64(bytes + 16) ^ SECRET2, Read64(bytes + 24) ^ state1);
+                    state2 = Mix(Read64(bytes + 32) ^ SECRET3, Read64(bytes + 40) ^ state2);
+                    bytes += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+
+                state ^= state1 ^ state2;
+            }
+
+            while (remaining > 16) {
+                state = Mix(Read64(bytes) ^ SECRET1, Read64(bytes + 8) ^ state);
+                bytes += 16;
+                remaining -= 16;
+            }
+
+            // The last 16 bytes, overlapping the already hashed ones if needed
+            a = Read64(bytes + remaining - 16);
+            b = Read64(bytes + remaining - 8);
+        }
+
+        a ^= SECRET1;
+        b ^= state;
+        Multiply(a, b);
+
+        return static_cast<hash_t>(Mix(a ^ SECRET0 ^ size, b ^ SECRET1));
+    }
+
+}  // namespace FunnyOS::Stdlib
@@ -1,18 +1,26 @@
 #include <FunnyOS/Stdlib/IniFile.hpp>
 
 namespace FunnyOS::Stdlib {
-    DynamicString IniSection::GetValue(const DynamicString& key) const {
+    StringView IniSection::GetValue(StringView key) const {
         const DynamicString* str = m_values.GetOptional(key);
 
-        return str == nullptr ? "" : *str;
+        return str == nullptr ? StringView{} : StringView{*str};
     }
 
-    void IniSection::SetValue(const DynamicString& key, DynamicString value) {
-        m_values.InsertOrReplace(key, Move(value));
+    void IniSection::SetValue(StringView key, DynamicString value) {
+        // The key is copied only when it is new
+        DynamicString* existing = m_values.GetOptional(key);
+
+        if (existing != nullptr) {
+            *existing = Move(value);
+            return;
+        }
+
+        m_values.Insert(DynamicString{key}, Move(value));
     }
 
     Vector<DynamicString> IniSection::GetKeyNames() const {
-        Vector<DynamicString> vector{};
+        Vector<DynamicString> vector(m_values.Size());
 
         for (const auto& entry : m_values) {
             vector.AppendInPlace(entry.Key);
@@ -21,28 +29,27 @@ namespace FunnyOS::Stdlib {
         return vector;
     }
 
-    DynamicString IniFile::GetValue(const DynamicString& sectionName, const DynamicString& key) const {
+    StringView IniFile::GetValue(StringView sectionName, StringView key) const {
         const IniSection* section = m_sections.GetOptional(sectionName);
         if (section == nullptr) {
-            return DynamicString{};
+            return StringView{};
         }
 
         return section->GetValue(key);
     }
 
-    DynamicString IniFile::GetValueOrDefault(
-        const DynamicString& section, const DynamicString& key, const char* defaultValue) const {
-        const DynamicString value = GetValue(section, key);
+    StringView IniFile::GetValueOrDefault(StringView section, StringView key, StringView defaultValue) const {
+        const StringView value = GetValue(section, key);
 
-        if (!value) {
-            return DynamicString{defaultValue};
+        if (value.IsEmpty()) {
+            return defaultValue;
         }
 
         return value;
     }
 
-    void IniFile::SetValue(const DynamicString& sectionName, const DynamicString& key, DynamicString value) {
-        GetSection(sectionName).SetValue(key, value);
+    void IniFile::SetValue(StringView sectionName, StringView key, DynamicString value) {
+        GetSection(sectionName).SetValue(key, Move(value));
     }
 
     IniSection& IniFile::GetDefaultSection() {
@@ -53,22 +60,22 @@ namespace FunnyOS::Stdlib {
         return GetSection("");
     }
 
-    IniSection& IniFile::GetSection(const DynamicString& name) {
+    IniSection& IniFile::GetSection(StringView name) {
         IniSection* section = m_sections.GetOptional(name);
 
         if (section == nullptr) {
-            section = m_sections.Insert(name, IniSection{});
+            section = m_sections.Insert(DynamicString{name}, IniSection{});
         }
 
         return *section;
     }
 
-    const IniSection* IniFile::GetSection(const DynamicString& name) const {
+    const IniSection* IniFile::GetSection(StringView name) const {
         return m_sections.GetOptional(name);
     }
 
     Vector<DynamicString> IniFile::GetSectionNames() const {
-        Vector<DynamicString> vector{};
+        Vector<DynamicString> vector(m_sections.Size());
 
         for (const auto& entry : m_sections) {
             vector.AppendInPlace(entry.Key);
@@ -1,10 +1,329 @@
 #include <FunnyOS/Stdlib/Memory.hpp>
 
+#include <FunnyOS/Stdlib/Arena.hpp>
+#include <FunnyOS/Stdlib/Compiler.hpp>
 #include <FunnyOS/Stdlib/Platform.hpp>
 
 namespace FunnyOS::Stdlib::Memory {
     namespace {
         void* g_zeroMemory = reinterpret_cast<void*>(NumeralTraits::Info<uintptr_t>::MaximumValue);
+
+        using CopyRoutine = void (*)(uint8_t* destination, const uint8_t* source, size_t size) noexcept;
+        using SetRoutine  = void (*)(uint8_t* destination, uint8_t byte, size_t size) noexcept;
+
+        typedef uint16_t UnalignedUint16 F_MAY_ALIAS F_UNALIGNED;
+        typedef uint32_t UnalignedUint32 F_MAY_ALIAS F_UNALIGNED;
+        typedef uint64_t UnalignedUint64 F_MAY_ALIAS F_UNALIGNED;
+
+        /**
+         * Copies and sets smaller than this are done with a few scalar loads and stores.
+         */
+        constexpr const size_t SMALL_SIZE = 16;
+
+        // Copies with two, possibly overlapping, words. Both words are loaded before they are stored, so the buffers may
+        // overlap. There is one function per word type, because the attributes of the types would be dropped if they
+        // were passed as template arguments.
+
+        inline void CopyHeadAndTail64(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            const uint64_t head = *reinterpret_cast<const UnalignedUint64*>(source);
+            const uint64_t tail = *reinterpret_cast<const UnalignedUint64*>(source + size - 8);
+
+            *reinterpret_cast<UnalignedUint64*>(destination)            = head;
+            *reinterpret_cast<UnalignedUint64*>(destination + size - 8) = tail;
+        }
+
+        inline void CopyHeadAndTail32(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            const uint32_t head = *reinterpret_cast<const UnalignedUint32*>(source);
+            const uint32_t tail = *reinterpret_cast<const UnalignedUint32*>(source + size - 4);
+
+            *reinterpret_cast<UnalignedUint32*>(destination)            = head;
+            *reinterpret_cast<UnalignedUint32*>(destination + size - 4) = tail;
+        }
+
+        inline void CopyHeadAndTail16(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            const uint16_t head = *reinterpret_cast<const UnalignedUint16*>(source);
+            const uint16_t tail = *reinterpret_cast<const UnalignedUint16*>(source + size - 2);
+
+            *reinterpret_cast<UnalignedUint16*>(destination)            = head;
+            *reinterpret_cast<UnalignedUint16*>(destination + size - 2) = tail;
+        }
+
+        /**
+         * Copies less than SMALL_SIZE bytes with two, possibly overlapping, words. Supports overlapping buffers.
+         */
+        inline void CopySmall(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            if (size >= 8) {
+                CopyHeadAndTail64(destination, source, size);
+            } else if (size >= 4) {
+                CopyHeadAndTail32(destination, source, size);
+            } else if (size >= 2) {
+                CopyHeadAndTail16(destination, source, size);
+            } else if (size == 1) {
+                *destination = *source;
+            }
+        }
+
+        /**
+         * Sets less than SMALL_SIZE bytes with two, possibly overlapping, words.
+         */
+        inline void SetSmall(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            const uint64_t word = static_cast<uint64_t>(byte) * 0x0101010101010101;
+
+            if (size >= 8) {
+                *reinterpret_cast<UnalignedUint64*>(destination)            = word;
+                *reinterpret_cast<UnalignedUint64*>(destination + size - 8) = word;
+            } else if (size >= 4) {
+                *reinterpret_cast<UnalignedUint32*>(destination)            = static_cast<uint32_t>(word);
+                *reinterpret_cast<UnalignedUint32*>(destination + size - 4) = static_cast<uint32_t>(word);
+            } else if (size >= 2) {
+                *reinterpret_cast<UnalignedUint16*>(destination)            = static_cast<uint16_t>(word);
+                *reinterpret_cast<UnalignedUint16*>(destination + size - 2) = static_cast<uint16_t>(word);
+            } else if (size == 1) {
+                *destination = byte;
+            }
+        }
+
+        /**
+         * Copies forwards with rep movsq followed by rep movsb for the remaining bytes. This is also safe for
+         * overlapping buffers if the destination is below the source.
+         */
+        void CopyWords(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                CopySmall(destination, source, size);
+                return;
+            }
+
+            size_t words = size / 8;
+            asm volatile("rep movsq\n\tmov %[bytes], %%rcx\n\trep movsb"
+                         : "+D"(destination), "+S"(source), "+c"(words)
+                         : [ bytes ] "r"(size % 8)
+                         : "memory");
+        }
+
+        /**
+         * Copies backwards, for overlapping buffers where the destination is above the source.
+         */
+        void CopyWordsBackwards(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            // Words from the end first, then the remaining bytes at the beginning. The direction flag must be cleared
+            // before the compiler gets control back, so this is a single statement.
+            uint8_t* lastWord      = destination + size - 8;
+            const uint8_t* srcWord = source + size - 8;
+            size_t words           = size / 8;
+            asm volatile(
+                "std\n\t"
+                "rep movsq\n\t"
+                "add $7, %%rdi\n\t"
+                "add $7, %%rsi\n\t"
+                "mov %[bytes], %%rcx\n\t"
+                "rep movsb\n\t"
+                "cld"
+                : "+D"(lastWord), "+S"(srcWord), "+c"(words)
+                : [ bytes ] "r"(size % 8)
+                : "memory", "cc");
+        }
+
+        /**
+         * Copies with rep movsb, which is the fastest way to copy on CPUs with enhanced rep movsb/stosb (ERMS).
+         */
+        void CopyErms(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                CopySmall(destination, source, size);
+                return;
+            }
+
+            asm volatile("rep movsb" : "+D"(destination), "+S"(source), "+c"(size) : : "memory");
+        }
+
+        void SetWords(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                SetSmall(destination, byte, size);
+                return;
+            }
+
+            size_t words = size / 8;
+            asm volatile("rep stosq\n\tmov %[bytes], %%rcx\n\trep stosb"
+                         : "+D"(destination), "+c"(words)
+                         : "a"(static_cast<uint64_t>(byte) * 0x0101010101010101), [ bytes ] "r"(size % 8)
+                         : "memory");
+        }
+
+        void SetErms(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                SetSmall(destination, byte, size);
+                return;
+            }
+
+            asm volatile("rep stosb" : "+D"(destination), "+c"(size) : "a"(byte) : "memory");
+        }
+
+#ifdef __SSE2__
+        /**
+         * From this size on rep movsb/stosb is faster than the vector loops, if the CPU has ERMS.
+         */
+        constexpr const size_t ERMS_MINIMUM_SIZE = 2048;
+
+        bool g_hasErms = false;
+
+        /**
+         * Copies with unaligned vector loads and stores, the last vector may overlap the previous one.
+         */
+        template <size_t VectorSize>
+        inline void CopyVectors(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            typedef uint8_t Vector F_VECTOR(VectorSize) F_MAY_ALIAS F_UNALIGNED;
+            const size_t last = size - VectorSize;
+
+            for (size_t i = 0; i < last; i += VectorSize) {
+                *reinterpret_cast<Vector*>(destination + i) = *reinterpret_cast<const Vector*>(source + i);
+            }
+
+            *reinterpret_cast<Vector*>(destination + last) = *reinterpret_cast<const Vector*>(source + last);
+        }
+
+        template <size_t VectorSize>
+        inline void SetVectors(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            typedef uint8_t Vector F_VECTOR(VectorSize) F_MAY_ALIAS F_UNALIGNED;
+            const Vector pattern = Vector{} + byte;
+            const size_t last    = size - VectorSize;
+
+            for (size_t i = 0; i < last; i += VectorSize) {
+                *reinterpret_cast<Vector*>(destination + i) = pattern;
+            }
+
+            *reinterpret_cast<Vector*>(destination + last) = pattern;
+        }
+
+        void CopySse2(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                CopySmall(destination, source, size);
+            } else if (g_hasErms && size >= ERMS_MINIMUM_SIZE) {
+                CopyErms(destination, source, size);
+            } else {
+                CopyVectors<16>(destination, source, size);
+            }
+        }
+
+        void SetSse2(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            if (size < SMALL_SIZE) {
+                SetSmall(destination, byte, size);
+            } else if (g_hasErms && size >= ERMS_MINIMUM_SIZE) {
+                SetErms(destination, byte, size);
+            } else {
+                SetVectors<16>(destination, byte, size);
+            }
+        }
+
+        F_TARGET("avx") void CopyAvx(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            if (size < 32) {
+                CopySse2(destination, source, size);
+            } else if (g_hasErms && size >= ERMS_MINIMUM_SIZE) {
+                CopyErms(destination, source, size);
+            } else {
+                CopyVectors<32>(destination, source, size);
+            }
+        }
+
+        F_TARGET("avx") void SetAvx(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            if (size < 32) {
+                SetSse2(destination, byte, size);
+            } else if (g_hasErms && size >= ERMS_MINIMUM_SIZE) {
+                SetErms(destination, byte, size);
+            } else {
+                SetVectors<32>(destination, byte, size);
+            }
+        }
+#endif
+
+        inline void Cpuid(uint32_t leaf, uint32_t (&registers)[4]) noexcept {
+            asm("cpuid"
+                : "=a"(registers[0]), "=b"(registers[1]), "=c"(registers[2]), "=d"(registers[3])
+                : "a"(leaf), "c"(0));
+        }
+
+        void SelectCopyAndCopy(uint8_t* destination, const uint8_t* source, size_t size) noexcept;
+
+        void SelectSetAndSet(uint8_t* destination, uint8_t byte, size_t size) noexcept;
+
+        /**
+         * Selected routines, until the first call they point at functions that select the routines.
+         */
+        CopyRoutine g_copyRoutine = &SelectCopyAndCopy;
+        SetRoutine g_setRoutine   = &SelectSetAndSet;
+
+        void SelectRoutines() noexcept {
+            uint32_t registers[4];
+
+            Cpuid(0, registers);
+            const uint32_t maximumLeaf = registers[0];
+
+            Cpuid(1, registers);
+            const bool hasAvx          = (registers[2] & (1 << 28)) != 0;
+            const bool hasXsaveEnabled = (registers[2] & (1 << 27)) != 0;
+
+            bool hasErms = false;
+            if (maximumLeaf >= 7) {
+                Cpuid(7, registers);
+                hasErms = (registers[1] & (1 << 9)) != 0;
+            }
+
+            g_copyRoutine = hasErms ? &CopyErms : &CopyWords;
+            g_setRoutine  = hasErms ? &SetErms : &SetWords;
+
+#ifdef __SSE2__
+            g_hasErms     = hasErms;
+            g_copyRoutine = &CopySse2;
+            g_setRoutine  = &SetSse2;
+
+            // AVX can be used only if the system saves the YMM registers
+            if (hasAvx && hasXsaveEnabled) {
+                uint32_t xcr0Low;
+                uint32_t xcr0High;
+                asm("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+
+                if ((xcr0Low & 0b110) == 0b110) {
+                    g_copyRoutine = &CopyAvx;
+                    g_setRoutine  = &SetAvx;
+                }
+            }
+#else
+            static_cast<void>(hasAvx);
+            static_cast<void>(hasXsaveEnabled);
+#endif
+        }
+
+        void SelectCopyAndCopy(uint8_t* destination, const uint8_t* source, size_t size) noexcept {
+            SelectRoutines();
+            g_copyRoutine(destination, source, size);
+        }
+
+        void SelectSetAndSet(uint8_t* destination, uint8_t byte, size_t size) noexcept {
+            SelectRoutines();
+            g_setRoutine(destination, byte, size);
+        }
+    }  // namespace
+
+    void Copy(void* destination, const void* source, size_t size) noexcept {
+        g_copyRoutine(static_cast<uint8_t*>(destination), static_cast<const uint8_t*>(source), size);
+    }
+
+    void Move(void* destination, const void* source, size_t size) noexcept {
+        auto* destinationBytes  = static_cast<uint8_t*>(destination);
+        const auto* sourceBytes = static_cast<const uint8_t*>(source);
+        const auto distance     = static_cast<uintptr_t>(destinationBytes - sourceBytes);
+
+        if (size < SMALL_SIZE) {
+            CopySmall(destinationBytes, sourceBytes, size);
+        } else if (distance >= size && -distance >= size) {
+            // The buffers do not overlap
+            g_copyRoutine(destinationBytes, sourceBytes, size);
+        } else if (destinationBytes < sourceBytes) {
+            CopyWords(destinationBytes, sourceBytes, size);
+        } else if (destinationBytes > sourceBytes) {
+            CopyWordsBackwards(destinationBytes, sourceBytes, size);
+        }
+    }
+
+    void Set(void* destination, uint8_t byte, size_t size) noexcept {
+        g_setRoutine(static_cast<uint8_t*>(destination), byte, size);
     }
 
     void* Allocate(size_t size) noexcept {
@@ -12,6 +331,10 @@ namespace FunnyOS::Stdlib::Memory {
             return g_zeroMemory;
         }
 
+        if (Arena* arena = Arena::GetActive()) {
+            return arena->Allocate(size, 1);
+        }
+
         return _Platform::AllocateMemoryAligned(size, 1);
     }
 
@@ -20,6 +343,10 @@ namespace FunnyOS::Stdlib::Memory {
             return g_zeroMemory;
         }
 
+        if (Arena* arena = Arena::GetActive()) {
+            return arena->Allocate(size, alignment);
+        }
+
         return _Platform::AllocateMemoryAligned(size, alignment);
     }
 
@@ -49,6 +376,11 @@ namespace FunnyOS::Stdlib::Memory {
             return g_zeroMemory;
         }
 
+        // Memory is always reallocated by its owner, regardless of the active arena
+        if (Arena* owner = Arena::FindOwner(data)) {
+            return owner->Reallocate(data, size, alignment);
+        }
+
         return _Platform::ReallocateMemoryAligned(data, size, alignment);
     }
 
@@ -57,6 +389,11 @@ namespace FunnyOS::Stdlib::Memory {
             return;
         }
 
+        if (Arena* owner = Arena::FindOwner(data)) {
+            owner->Free(data);
+            return;
+        }
+
         _Platform::FreeMemory(data);
     }
 }  // namespace FunnyOS::Stdlib::Memory
@@ -75,8 +412,7 @@ void* memmove(void* dest, const void* src, size_t count) {
 }
 
 void* memset(void* dest, int value, size_t count) {
-    Memory::SizedBuffer<uint8_t> buffer{static_cast<uint8_t*>(dest), count};
-    Memory::Set<uint8_t>(buffer, static_cast<uint8_t>(value));
+    Memory::Set(dest, static_cast<uint8_t>(value), count);
     return dest;
 }
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include <FunnyOS/Stdlib/ObjectCache.hpp>
+
+#include <FunnyOS/Stdlib/Memory.hpp>
+#include <FunnyOS/Stdlib/Platform.hpp>
+
+namespace FunnyOS::Stdlib {
+    namespace {
+        template <typename T>
+        inline T* OffsetPointer(void* pointer, size_t offset) {
+            return reinterpret_cast<T*>(static_cast<uint8_t*>(pointer) + offset);
+        }
+
+        /**
+         * Reads the pointer to the next free object, stored in a free object.
+         */
+        inline void* GetNextFreeObject(void* object) {
+            return *static_cast<void**>(object);
+        }
+
+        /**
+         * Stores the pointer to the next free object in a free object.
+         */
+        inline void SetNextFreeObject(void* object, void* next) {
+            *static_cast<void**>(object) = next;
+        }
+    }  // namespace
+
+    SlabCache::~SlabCache() {
+        FreeSlabs(m_partialSlabs);
+        FreeSlabs(m_fullSlabs);
+
+        m_partialSlabs = nullptr;
+        m_fullSlabs    = nullptr;
+        m_emptySlabs   = 0;
+        m_slabCount    = 0;
+    }
+
+    void* SlabCache::Allocate() noexcept {
+        SlabHeader* slab = m_partialSlabs;
+
+        if (slab == nullptr) {
+            slab = CreateSlab();
+
+            if (slab == nullptr) {
+                return nullptr;
+            }
+        }
+
+        if (slab->UsedObjects == 0) {
+            m_emptySlabs--;
+        }
+
+        void* object      = slab->FreeObjects;
+        slab->FreeObjects = GetNextFreeObject(object);
+        slab->UsedObjects++;
+
+        // Full slabs are only tracked so the destructor can find them
+        if (slab->FreeObjects == nullptr) {
+            UnlinkSlab(m_partialSlabs, slab);
+            LinkSlab(m_fullSlabs, slab);
+        }
+
+        return object;
+    }
+
+    void SlabCache::Free(void* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+
+        auto* slab = reinterpret_cast<SlabHeader*>(reinterpret_cast<uintptr_t>(object) & ~(SLAB_SIZE - 1));
+        F_ASSERT_NOEXCEPT(slab->Cache == this, "object freed to a wrong slab cache");
+        F_ASSERT_NOEXCEPT(slab->UsedObjects > 0, "object freed from an empty slab");
+
+        if (slab->FreeObjects == nullptr) {
+            UnlinkSlab(m_fullSlabs, slab);
+            LinkSlab(m_partialSlabs, slab);
+        }
+
+        SetNextFreeObject(object, slab->FreeObjects);
+        slab->FreeObjects = object;
+        slab->UsedObjects--;
+
+        if (slab->UsedObjects != 0) {
+            return;
+        }
+
+        // Keep one empty slab around so a single object being allocated and freed repeatedly does not allocate a new
+        // slab every time.
+        if (m_emptySlabs == 0) {
+            m_emptySlabs++;
+            return;
+        }
+
+        UnlinkSlab(m_partialSlabs, slab);
+        m_slabCount--;
+        _Platform::FreeMemory(slab);
+    }
+
+    size_t SlabCache::GetObjectSize() const noexcept {
+        return m_objectSize;
+    }
+
+    size_t SlabCache::GetObjectsPerSlab() const noexcept {
+        return m_objectsPerSlab;
+    }
+
+    size_t SlabCache::GetSlabCount() const noexcept {
+        return m_slabCount;
+    }
+
+    SlabCache::SlabHeader* SlabCache::CreateSlab() noexcept {
+        F_ASSERT_NOEXCEPT(m_objectsPerSlab > 0, "object too big for a slab");
+
+        // Slabs are shared by the whole program, so they are never allocated from the active Arena
+        auto* slab = static_cast<SlabHeader*>(_Platform::AllocateMemoryAligned(SLAB_SIZE, SLAB_SIZE));
+        if (slab == nullptr) {
+            return nullptr;
+        }
+
+        slab->Cache       = this;
+        slab->Next        = nullptr;
+        slab->Previous    = nullptr;
+        slab->UsedObjects = 0;
+
+        // Thread all objects in a free list, in address order
+        void* next = nullptr;
+        for (size_t i = m_objectsPerSlab; i > 0; i--) {
+            void* object = OffsetPointer<void>(slab, m_firstObjectOffset + (i - 1) * m_objectSize);
+            SetNextFreeObject(object, next);
+            next = object;
+        }
+        slab->FreeObjects = next;
+
+        LinkSlab(m_partialSlabs, slab);
+        m_emptySlabs++;
+        m_slabCount++;
+        return slab;
+    }
+
+    void SlabCache::LinkSlab(SlabHeader*& list, SlabHeader* slab) noexcept {
+        slab->Previous = nullptr;
+        slab->Next     = list;
+
+        if (list != nullptr) {
+            list->Previous = slab;
+        }
+
+        list = slab;
+    }
+
+    void SlabCache::UnlinkSlab(SlabHeader*& list, SlabHeader* slab) noexcept {
+        if (slab->Previous != nullptr) {
+            slab->Previous->Next = slab->Next;
+        } else {
+            list = slab->Next;
+        }
+
+        if (slab->Next != nullptr) {
+            slab->Next->Previous = slab->Previous;
+        }
+
+        slab->Next     = nullptr;
+        slab->Previous = nullptr;
+    }
+
+    void SlabCache::FreeSlabs(SlabHeader* list) noexcept {
+        while (list != nullptr) {
+            SlabHeader* next = list->Next;
+            _Platform::FreeMemory(list);
+            list = next;
+        }
+    }
+}  // namespace FunnyOS::Stdlib
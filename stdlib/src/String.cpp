@@ -1,8 +1,137 @@
 #include <FunnyOS/Stdlib/String.hpp>
 
 #include <FunnyOS/Stdlib/Algorithm.hpp>
+#include <FunnyOS/Stdlib/Compiler.hpp>
 
 namespace FunnyOS::Stdlib::String {
+    namespace {
+        /**
+         * Smallest page size, aligned blocks never cross it.
+         */
+        constexpr const uintptr_t PAGE_SIZE = 4096;
+
+        /**
+         * The strings are scanned in blocks, a mask has a set bit for every character in the block that matched.
+         * The blocks are read aligned, so they never cross a page and reading past the terminator is always safe.
+         */
+#ifdef __SSE2__
+        typedef char Block F_VECTOR(16) F_MAY_ALIAS;
+        typedef char UnalignedBlock F_VECTOR(16) F_MAY_ALIAS F_UNALIGNED;
+
+        constexpr const size_t BLOCK_SIZE         = 16;
+        constexpr const size_t BITS_PER_CHARACTER = 1;
+
+        inline uint64_t EqualMask(Block block1, Block block2) noexcept {
+            return static_cast<uint16_t>(__builtin_ia32_pmovmskb128(block1 == block2));
+        }
+
+        inline uint64_t ZeroMask(Block block) noexcept {
+            return EqualMask(block, Block{});
+        }
+
+        inline uint64_t CharacterMask(Block block, char character) noexcept {
+            return EqualMask(block, Block{} + character);
+        }
+
+        inline uint64_t DifferenceMask(Block block1, Block block2) noexcept {
+            return EqualMask(block1, block2) ^ 0xFFFF;
+        }
+
+        inline size_t CountMatches(uint64_t mask) noexcept {
+            size_t count = 0;
+            for (; mask != 0; mask &= mask - 1) {
+                count++;
+            }
+
+            return count;
+        }
+#else
+        // SWAR, the mask has the highest bit of every matching byte set
+        typedef uint64_t Block F_MAY_ALIAS;
+        typedef uint64_t UnalignedBlock F_MAY_ALIAS F_UNALIGNED;
+
+        constexpr const size_t BLOCK_SIZE         = 8;
+        constexpr const size_t BITS_PER_CHARACTER = 8;
+
+        constexpr const uint64_t LOW_BITS  = 0x7F7F7F7F7F7F7F7F;
+        constexpr const uint64_t ONE_BYTES = 0x0101010101010101;
+
+        inline uint64_t ZeroMask(Block block) noexcept {
+            // Exact for every byte, unlike (x - 0x01..) & ~x & 0x80.., which may also flag bytes above a zero byte
+            return ~(((block & LOW_BITS) + LOW_BITS) | block | LOW_BITS);
+        }
+
+        inline uint64_t CharacterMask(Block block, char character) noexcept {
+            return ZeroMask(block ^ (static_cast<uint8_t>(character) * ONE_BYTES));
+        }
+
+        inline uint64_t DifferenceMask(Block block1, Block block2) noexcept {
+            return ZeroMask(block1 ^ block2) ^ ~LOW_BITS;
+        }
+
+        inline size_t CountMatches(uint64_t mask) noexcept {
+            // At most one bit per byte, so the sum of the bytes fits in the highest byte
+            return static_cast<size_t>(((mask >> 7) * ONE_BYTES) >> 56);
+        }
+#endif
+
+        /**
+         * The aligned block may extend past the terminator, which AddressSanitizer would report as an overflow. The
+         * functions that scan blocks are not instrumented for the same reason.
+         */
+        F_NO_SANITIZE_ADDRESS inline Block LoadBlock(const char* block) noexcept {
+            return *reinterpret_cast<const Block*>(block);
+        }
+
+        /**
+         * Mask of the characters that are at or after [offset] in the block.
+         */
+        inline uint64_t MaskFrom(size_t offset) noexcept {
+            return ~static_cast<uint64_t>(0) << (offset * BITS_PER_CHARACTER);
+        }
+
+        /**
+         * Mask of the characters that are before the first character set in [mask].
+         */
+        inline uint64_t MaskBefore(uint64_t mask) noexcept {
+            return (mask & -mask) - 1;
+        }
+
+        inline size_t FirstIndex(uint64_t mask) noexcept {
+            return F_COUNT_TRAILING_ZEROS_64(mask) / BITS_PER_CHARACTER;
+        }
+
+        inline size_t LastIndex(uint64_t mask) noexcept {
+            return (63 - F_COUNT_LEADING_ZEROS_64(mask)) / BITS_PER_CHARACTER;
+        }
+
+        inline const char* AlignDown(const char* string) noexcept {
+            return string - reinterpret_cast<uintptr_t>(string) % BLOCK_SIZE;
+        }
+
+        /**
+         * Compares a single pair of characters.
+         *
+         * @return whether or not the comparison ends at these characters, [result] is set if so
+         */
+        inline bool CompareCharacters(char c1, char c2, int& result) noexcept {
+            // If string ends with a null, the result is 0 if both end and < 0 otherwise
+            if (c1 == 0) {
+                result = -c2;
+                return true;
+            }
+
+            // c2 has finished, so result > 0, string1 has a bigger value
+            if (c2 == 0) {
+                result = c1;
+                return true;
+            }
+
+            const char diff = c1 - c2;  // NOLINT(bugprone-narrowing-conversions)
+            result          = diff;
+            return diff != 0;
+        }
+    }  // namespace
 
     StringBuffer AllocateBuffer(size_t size) {
         StringBuffer buffer = Memory::AllocateBuffer<char>(size);
@@ -38,13 +167,16 @@ namespace FunnyOS::Stdlib::String {
         return buffer;
     }
 
-    size_t Length(const char* string) noexcept {
-        size_t length = 0;
-        while (*(string + length) != 0) {
-            length++;
+    F_NO_SANITIZE_ADDRESS size_t Length(const char* string) noexcept {
+        const char* block = AlignDown(string);
+        uint64_t zeros    = ZeroMask(LoadBlock(block)) & MaskFrom(string - block);
+
+        while (zeros == 0) {
+            block += BLOCK_SIZE;
+            zeros = ZeroMask(LoadBlock(block));
         }
 
-        return length;
+        return block + FirstIndex(zeros) - string;
     }
 
     bool Concat(StringBuffer& buffer, const char* string1, const char* string2) noexcept {
@@ -82,30 +214,46 @@ namespace FunnyOS::Stdlib::String {
         return CompareWithMax(string1, string2, NumeralTraits::Info<size_t>::MaximumValue);
     }
 
-    int CompareWithMax(const char* string1, const char* string2, size_t length) noexcept {
-        for (size_t i = 0; i < length; i++) {
-            const char c1 = *(string1 + i);
-            const char c2 = *(string2 + i);
+    F_NO_SANITIZE_ADDRESS int CompareWithMax(const char* string1, const char* string2, size_t length) noexcept {
+        size_t i   = 0;
+        int result = 0;
 
-            // If string ends with a null
-            if (c1 == 0) {
-                if (c2 == 0) {  // Both end and the same time, they are equal
-                    return 0;
+        // Characters before the first aligned block of string1
+        for (; i < length && reinterpret_cast<uintptr_t>(string1 + i) % BLOCK_SIZE != 0; i++) {
+            if (CompareCharacters(string1[i], string2[i], result)) {
+                return result;
+            }
+        }
+
+        // Blocks of string1 are read aligned, blocks of string2 are compared by characters if they cross a page
+        while (length - i >= BLOCK_SIZE) {
+            if (reinterpret_cast<uintptr_t>(string2 + i) % PAGE_SIZE > PAGE_SIZE - BLOCK_SIZE) {
+                for (const size_t blockEnd = i + BLOCK_SIZE; i < blockEnd; i++) {
+                    if (CompareCharacters(string1[i], string2[i], result)) {
+                        return result;
+                    }
                 }
 
-                // Otherwise we should return result < 0
-                return -c2;
+                continue;
             }
 
-            // c2 has finished, so result > 0, string1 has a bigger value
-            if (c2 == 0) {
-                return c1;
+            const Block block1 = LoadBlock(string1 + i);
+            const Block block2 = *reinterpret_cast<const UnalignedBlock*>(string2 + i);
+            const uint64_t end = ZeroMask(block1) | DifferenceMask(block1, block2);
+
+            if (end != 0) {
+                i += FirstIndex(end);
+                CompareCharacters(string1[i], string2[i], result);
+                return result;
             }
 
-            const char diff = c1 - c2;  // NOLINT(bugprone-narrowing-conversions)
+            i += BLOCK_SIZE;
+        }
 
-            if (diff != 0) {
-                return diff;
+        // Characters after the last whole block
+        for (; i < length; i++) {
+            if (CompareCharacters(string1[i], string2[i], result)) {
+                return result;
             }
         }
 
@@ -113,44 +261,81 @@ namespace FunnyOS::Stdlib::String {
         return 0;
     }
 
-    int IndexOf(const char* string, char character) {
-        int i = 0;
+    F_NO_SANITIZE_ADDRESS int IndexOf(const char* string, char character) {
+        if (character == 0) {
+            return -1;
+        }
 
-        while (string[i] != 0) {
-            if (string[i] == character) {
-                return i;
-            }
+        const char* block = AlignDown(string);
+        Block value       = LoadBlock(block);
+        uint64_t found    = (ZeroMask(value) | CharacterMask(value, character)) & MaskFrom(string - block);
 
-            i++;
+        while (found == 0) {
+            block += BLOCK_SIZE;
+            value = LoadBlock(block);
+            found = ZeroMask(value) | CharacterMask(value, character);
         }
 
-        return -1;
+        const char* position = block + FirstIndex(found);
+        return *position == character ? static_cast<int>(position - string) : -1;
     }
 
-    int LastIndexOf(const char* string, char character) {
-        int i = Length(string) - 1;
+    F_NO_SANITIZE_ADDRESS int LastIndexOf(const char* string, char character) {
+        if (character == 0) {
+            return -1;
+        }
+
+        const char* block        = AlignDown(string);
+        const char* lastPosition = nullptr;
+        uint64_t head            = MaskFrom(string - block);
+
+        while (true) {
+            const Block value    = LoadBlock(block);
+            const uint64_t zeros = ZeroMask(value) & head;
+            uint64_t matches     = CharacterMask(value, character) & head;
+
+            if (zeros != 0) {
+                matches &= MaskBefore(zeros);
+            }
+
+            if (matches != 0) {
+                lastPosition = block + LastIndex(matches);
+            }
 
-        while (i >= 0) {
-            if (string[i] == character) {
-                return i;
+            if (zeros != 0) {
+                break;
             }
 
-            i--;
+            block += BLOCK_SIZE;
+            head = ~static_cast<uint64_t>(0);
         }
 
-        return -1;
+        return lastPosition == nullptr ? -1 : static_cast<int>(lastPosition - string);
     }
 
-    int Count(const char* string, const char* pattern) {
-        int count = 0;
+    F_NO_SANITIZE_ADDRESS int Count(const char* string, const char* pattern) {
+        const char* block = AlignDown(string);
+        uint64_t head     = MaskFrom(string - block);
+        size_t count      = 0;
 
-        while (*string) {
-            if (Matches(*(string++), pattern)) {
-                count++;
+        while (true) {
+            const Block value    = LoadBlock(block);
+            const uint64_t zeros = ZeroMask(value) & head;
+            uint64_t matches     = 0;
+
+            for (const char* character = pattern; *character != 0; character++) {
+                matches |= CharacterMask(value, *character);
+            }
+
+            matches &= head;
+            if (zeros != 0) {
+                return static_cast<int>(count + CountMatches(matches & MaskBefore(zeros)));
             }
-        }
 
-        return count;
+            count += CountMatches(matches);
+            block += BLOCK_SIZE;
+            head = ~static_cast<uint64_t>(0);
+        }
     }
 
     char* NextToken(char** currentString, const char* tokenSeparatorList) {
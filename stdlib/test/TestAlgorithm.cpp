@@ -58,4 +58,31 @@ TEST(TestAlgorithm, TestRemoveIf) {
 
     DoTestRemoveIf(vector);
     DoTestRemoveIf(linkedList);
-}
\ No newline at end of file
+}
+TEST(TestAlgorithm, TestRemoveIfSinglePass) {
+    using namespace FunnyOS::Stdlib;
+
+    Vector<int> vector;
+    for (int i = 0; i < 1000; i++) {
+        vector.Append(i);
+    }
+
+    // A contiguous container is compacted, every element is tested once
+    size_t tests        = 0;
+    const size_t erased = RemoveIf(vector, [&tests](int it) {
+        tests++;
+        return it % 3 != 0;
+    });
+
+    EXPECT_EQ(1000, tests);
+    EXPECT_EQ(666, erased);
+    ASSERT_EQ(334, vector.Size());
+
+    for (size_t i = 0; i < vector.Size(); i++) {
+        EXPECT_EQ(static_cast<int>(i) * 3, vector[i]);
+    }
+
+    EXPECT_EQ(0, RemoveIf(vector, [](int) { return false; }));
+    EXPECT_EQ(334, RemoveIf(vector, [](int) { return true; }));
+    EXPECT_EQ(0, vector.Size());
+}
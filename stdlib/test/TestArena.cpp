@@ -0,0 +1,203 @@
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/Arena.hpp>
+#include <FunnyOS/Stdlib/DynamicString.hpp>
+#include <FunnyOS/Stdlib/HashMap.hpp>
+#include <FunnyOS/Stdlib/IniFile.hpp>
+#include <FunnyOS/Stdlib/Memory.hpp>
+#include <FunnyOS/Stdlib/Vector.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Stdlib;
+
+TEST(TestArena, TestBumpAllocation) {
+    Arena arena{256};
+    EXPECT_EQ(0, arena.GetChunkCount());
+
+    auto* first  = static_cast<uint8_t*>(arena.Allocate(16, 8));
+    auto* second = static_cast<uint8_t*>(arena.Allocate(16, 8));
+    auto* third  = static_cast<uint8_t*>(arena.Allocate(1, 64));
+
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, third);
+    EXPECT_EQ(1, arena.GetChunkCount());
+    EXPECT_LT(first, second);
+    EXPECT_LE(first + 16, second);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(third) % 64);
+
+    EXPECT_TRUE(arena.Owns(first));
+    EXPECT_TRUE(arena.Owns(third));
+    EXPECT_EQ(&arena, Arena::FindOwner(second));
+
+    // Does not fit in the current chunk
+    void* big = arena.Allocate(1024, 8);
+    ASSERT_NE(nullptr, big);
+    EXPECT_EQ(2, arena.GetChunkCount());
+    EXPECT_TRUE(arena.Owns(big));
+
+    int onStack = 0;
+    EXPECT_FALSE(arena.Owns(&onStack));
+    EXPECT_EQ(nullptr, Arena::FindOwner(&onStack));
+}
+
+TEST(TestArena, TestLastAllocationIsReused) {
+    Arena arena{256};
+
+    void* first  = arena.Allocate(16, 8);
+    void* second = arena.Allocate(16, 8);
+
+    // Only the most recent allocation is reclaimed
+    arena.Free(first);
+    arena.Free(second);
+    EXPECT_EQ(second, arena.Allocate(16, 8));
+
+    // And it grows in place
+    auto* grown = static_cast<uint8_t*>(arena.Reallocate(second, 64, 8));
+    EXPECT_EQ(second, grown);
+
+    Memory::SizedBuffer<uint8_t> buffer{grown, 64};
+    Memory::Set(buffer, static_cast<uint8_t>(0xAB));
+
+    auto* third = static_cast<uint8_t*>(arena.Allocate(8, 8));
+    EXPECT_LE(grown + 64, third);
+
+    // Other allocations are copied
+    auto* moved = static_cast<uint8_t*>(arena.Reallocate(grown, 128, 8));
+    EXPECT_NE(grown, moved);
+    for (size_t i = 0; i < 64; i++) {
+        ASSERT_EQ(0xAB, moved[i]);
+    }
+}
+
+TEST(TestArena, TestResetKeepsFirstChunk) {
+    Arena arena{256};
+
+    void* first = arena.Allocate(16, 8);
+    for (int i = 0; i < 16; i++) {
+        ASSERT_NE(nullptr, arena.Allocate(64, 8));
+    }
+    EXPECT_LT(1, arena.GetChunkCount());
+
+    arena.Reset();
+    EXPECT_EQ(1, arena.GetChunkCount());
+    EXPECT_EQ(first, arena.Allocate(16, 8));
+}
+
+TEST(TestArena, TestScopeRoutesAllocations) {
+    Arena arena;
+    void* heapMemory = Memory::Allocate(16);
+
+    {
+        ArenaScope scope{arena};
+
+        Vector<int> vector;
+        for (int i = 0; i < 100; i++) {
+            vector.Append(i);
+        }
+
+        // Long enough to not fit in the inline storage of the string
+        DynamicString string{"Hello"};
+        string.Append(DynamicString{", world, this string lives in the arena"});
+
+        HashMap<int, int> map;
+        for (int i = 0; i < 100; i++) {
+            map.Insert(i, i * 2);
+        }
+
+        void* arenaMemory = Memory::Allocate(16);
+        EXPECT_TRUE(arena.Owns(arenaMemory));
+        EXPECT_TRUE(arena.Owns(string.AsCString()));
+        EXPECT_TRUE(arena.Owns(&vector[0]));
+        Memory::Free(arenaMemory);
+
+        // Memory allocated outside of the scope is still managed by the heap
+        heapMemory = Memory::Reallocate(heapMemory, 4096);
+        EXPECT_FALSE(arena.Owns(heapMemory));
+
+        EXPECT_EQ(99, vector[99]);
+        EXPECT_STREQ("Hello, world, this string lives in the arena", string.AsCString());
+        EXPECT_EQ(100, map.Size());
+        EXPECT_EQ(198, *map.GetOptional(99));
+    }
+
+    EXPECT_EQ(nullptr, Arena::GetActive());
+
+    void* afterScope = Memory::Allocate(16);
+    EXPECT_FALSE(arena.Owns(afterScope));
+    Memory::Free(afterScope);
+    Memory::Free(heapMemory);
+}
+
+TEST(TestArena, TestNestedScopes) {
+    Arena outer;
+    Arena inner;
+
+    ArenaScope outerScope{outer};
+    EXPECT_EQ(&outer, Arena::GetActive());
+
+    {
+        ArenaScope innerScope{inner};
+        EXPECT_EQ(&inner, Arena::GetActive());
+
+        void* memory = Memory::Allocate(16);
+        EXPECT_TRUE(inner.Owns(memory));
+        EXPECT_FALSE(outer.Owns(memory));
+    }
+
+    EXPECT_EQ(&outer, Arena::GetActive());
+    EXPECT_TRUE(outer.Owns(Memory::Allocate(16)));
+}
+
+TEST(TestArena, TestFindOwner) {
+    Arena first;
+    Arena second;
+
+    void* firstMemory  = first.Allocate(16, 8);
+    void* secondMemory = second.Allocate(16, 8);
+    void* heapMemory   = Memory::Allocate(16);
+
+    EXPECT_EQ(&first, Arena::FindOwner(firstMemory));
+    EXPECT_EQ(&second, Arena::FindOwner(secondMemory));
+    EXPECT_EQ(nullptr, Arena::FindOwner(heapMemory));
+
+    // A copy of a valid header in front of memory that is not owned by the arena is not trusted
+    auto* buffer = static_cast<uint8_t*>(Memory::Allocate(64));
+    Memory::Copy(buffer, static_cast<uint8_t*>(firstMemory) - 32, 48);
+    EXPECT_EQ(nullptr, Arena::FindOwner(buffer + 32));
+
+    Memory::Free(buffer);
+    Memory::Free(heapMemory);
+}
+
+TEST(TestArena, TestFreeLargeHeapMemory) {
+    Arena arena{4096};
+    (void)arena.Allocate(16, 8);
+
+    // Big enough to get its own mapping, the memory in front of it is not readable
+    void* memory = Memory::Allocate(8 << 20);
+    ASSERT_NE(nullptr, memory);
+    EXPECT_EQ(nullptr, Arena::FindOwner(memory));
+
+    Memory::Free(memory);
+}
+
+TEST(TestArena, TestParseAndDiscard) {
+    const char* file = "[network]\nhost = localhost\nport = 8080\n";
+    Arena arena;
+
+    for (int i = 0; i < 3; i++) {
+        ArenaScope scope{arena};
+
+        IniFileReader reader{MakeOwnerBase<IReadInterface, FromMemoryReadInterface>(
+            reinterpret_cast<const uint8_t*>(file), String::Length(file))};
+        IniFile ini = reader.Read();
+
+        EXPECT_TRUE(ini.GetValue("network", "host") == "localhost");
+        EXPECT_TRUE(ini.GetValue("network", "port") == "8080");
+    }
+
+    // All memory of the parses is discarded at once
+    arena.Reset();
+    EXPECT_EQ(1, arena.GetChunkCount());
+}
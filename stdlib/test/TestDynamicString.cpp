@@ -93,3 +93,73 @@ TEST(TestDynamicString, TestToUppercase) {
     EXPECT_STREQ("HELLO, THIS IS A TEST STRING TO BE CONVERTED TO UPPER CASE", str.Begin());
 }
 
+
+TEST(TestDynamicString, TestInlineAndHeapStorage) {
+    using namespace FunnyOS::Stdlib;
+
+    const DynamicString empty{};
+    EXPECT_EQ(0, empty.Size());
+    EXPECT_STREQ("", empty.AsCString());
+    EXPECT_FALSE(empty);
+
+    // Exactly full inline storage, the terminator shares its place with the inline size
+    DynamicString full{"abcdefghijklmnopqrstuvw"};
+    ASSERT_EQ(DynamicString::INLINE_CAPACITY, full.Size());
+    EXPECT_EQ(DynamicString::INLINE_CAPACITY, full.Capacity());
+    EXPECT_STREQ("abcdefghijklmnopqrstuvw", full.AsCString());
+
+    // One more character moves the string to the heap
+    full.Append('x');
+    EXPECT_EQ(DynamicString::INLINE_CAPACITY + 1, full.Size());
+    EXPECT_GT(full.Capacity(), DynamicString::INLINE_CAPACITY);
+    EXPECT_STREQ("abcdefghijklmnopqrstuvwx", full.AsCString());
+
+    // Clearing keeps the heap, shrinking moves a short string back inline
+    full.Clear();
+    full.Append(DynamicString{"short"});
+    EXPECT_GT(full.Capacity(), DynamicString::INLINE_CAPACITY);
+    full.ShrinkToSize();
+    EXPECT_EQ(DynamicString::INLINE_CAPACITY, full.Capacity());
+    EXPECT_STREQ("short", full.AsCString());
+}
+
+TEST(TestDynamicString, TestCopyAndMove) {
+    using namespace FunnyOS::Stdlib;
+
+    for (const char* text : {"short", "a string that is too long to be stored inline"}) {
+        DynamicString original{text};
+
+        DynamicString copy{original};
+        EXPECT_STREQ(text, copy.AsCString());
+        EXPECT_NE(copy.AsCString(), original.AsCString());
+        EXPECT_TRUE(copy == original);
+
+        DynamicString moved{Move(copy)};
+        EXPECT_STREQ(text, moved.AsCString());
+        EXPECT_EQ(0, copy.Size());
+        EXPECT_STREQ("", copy.AsCString());
+
+        DynamicString assigned{"something else, long enough for the heap"};
+        assigned = moved;
+        EXPECT_STREQ(text, assigned.AsCString());
+
+        assigned = Move(moved);
+        EXPECT_STREQ(text, assigned.AsCString());
+        EXPECT_EQ(0, moved.Size());
+
+        // Appending a string to itself must not read freed characters
+        assigned.Append(assigned);
+        EXPECT_EQ(2 * original.Size(), assigned.Size());
+    }
+}
+
+TEST(TestDynamicString, TestReplaceAdjacent) {
+    using namespace FunnyOS::Stdlib;
+
+    DynamicString str{"testtest-test"};
+    str.Replace("test", "x");
+    EXPECT_STREQ("xx-x", str.AsCString());
+
+    str.Replace("x", "");
+    EXPECT_STREQ("-", str.AsCString());
+}
@@ -0,0 +1,71 @@
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/DynamicString.hpp>
+#include <FunnyOS/Stdlib/Hash.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Stdlib;
+
+TEST(TestHash, TestHashBytesEqualData) {
+    char buffer1[128];
+    char buffer2[128 + 7];
+
+    for (size_t i = 0; i < sizeof(buffer1); i++) {
+        buffer1[i]     = static_cast<char>(i * 7);
+        buffer2[i + 7] = static_cast<char>(i * 7);
+    }
+
+    // Equal data hashes the same regardless of its alignment
+    for (size_t size = 0; size <= sizeof(buffer1); size++) {
+        ASSERT_EQ(HashBytes(buffer1, size), HashBytes(buffer2 + 7, size)) << "size " << size;
+    }
+}
+
+TEST(TestHash, TestHashBytesEveryByteMatters) {
+    char buffer[128] = {};
+
+    // Every byte of every size, from the 1-3 byte reads to the 48 byte blocks, must change the hash
+    for (size_t size = 1; size <= sizeof(buffer); size++) {
+        const hash_t hash = HashBytes(buffer, size);
+
+        for (size_t i = 0; i < size; i++) {
+            buffer[i] = 1;
+            ASSERT_NE(hash, HashBytes(buffer, size)) << "size " << size << ", byte " << i;
+            buffer[i] = 0;
+        }
+
+        ASSERT_NE(hash, HashBytes(buffer, size + 1 > sizeof(buffer) ? size - 1 : size + 1));
+    }
+
+    ASSERT_NE(HashBytes(buffer, 16, 0), HashBytes(buffer, 16, 1));
+}
+
+TEST(TestHash, TestIntegerHashSpreadsLowBits) {
+    // Sequential keys and keys that differ only in their high bits must both fill a power-of-two table evenly
+    constexpr const size_t BUCKETS = 64;
+
+    for (const uint64_t stride : {1ULL, 4096ULL, 1ULL << 40}) {
+        size_t loads[BUCKETS] = {};
+
+        for (uint64_t i = 0; i < BUCKETS * 16; i++) {
+            loads[Hash<uint64_t>{}(i * stride) & (BUCKETS - 1)]++;
+        }
+
+        for (const size_t load : loads) {
+            ASSERT_GT(load, 0) << "stride " << stride;
+            ASSERT_LT(load, 48) << "stride " << stride;
+        }
+    }
+
+    ASSERT_EQ(Hash<int32_t>{}(-1), Hash<int64_t>{}(-1));
+}
+
+TEST(TestHash, TestDynamicStringHash) {
+    const DynamicString string1{"Hello world"};
+    const DynamicString string2{"Hello world"};
+    const DynamicString string3{"Hello World"};
+
+    ASSERT_EQ(Hash<DynamicString>{}(string1), Hash<DynamicString>{}(string2));
+    ASSERT_NE(Hash<DynamicString>{}(string1), Hash<DynamicString>{}(string3));
+    ASSERT_EQ(Hash<DynamicString>{}(string1), HashBytes("Hello world", 11));
+}
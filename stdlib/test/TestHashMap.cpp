@@ -36,4 +36,135 @@ TEST(TestHashmap, TestInsert) {
     ASSERT_EQ(map.GetOptional(23), nullptr);
 }
 
+TEST(TestHashmap, TestInsertOrReplace) {
+    HashMap<int, DynamicString> map{};
+
+    map.InsertOrReplace(3, DynamicString{"first"});
+    map.InsertOrReplace(3, DynamicString{"second"});
+
+    ASSERT_EQ(1, map.Size());
+    ASSERT_STREQ("second", map[3].AsCString());
+    ASSERT_EQ(nullptr, map.InsertIfNotExist(3, DynamicString{"third"}));
+    ASSERT_STREQ("second", map[3].AsCString());
+}
+
+TEST(TestHashmap, TestGrowAndRemove) {
+    HashMap<int, int> map{};
+
+    for (int i = 0; i < 1000; i++) {
+        map.Insert(i, i * 2);
+    }
+
+    ASSERT_EQ(1000, map.Size());
+
+    // Remove every odd key, the probe sequences of the remaining keys must stay intact
+    for (int i = 1; i < 1000; i += 2) {
+        ASSERT_TRUE(map.Remove(i));
+    }
+
+    ASSERT_FALSE(map.Remove(1));
+    ASSERT_EQ(500, map.Size());
 
+    for (int i = 0; i < 1000; i++) {
+        if (i % 2 == 0) {
+            ASSERT_NE(nullptr, map.GetOptional(i));
+            ASSERT_EQ(i * 2, *map.GetOptional(i));
+        } else {
+            ASSERT_EQ(nullptr, map.GetOptional(i));
+        }
+    }
+}
+
+TEST(TestHashmap, TestIterate) {
+    HashMap<int, int> map{};
+
+    for (int i = 0; i < 100; i++) {
+        map.Insert(i * 7, i);
+    }
+
+    int count = 0;
+    int sum   = 0;
+    for (const auto& entry : map) {
+        ASSERT_EQ(entry.Key, entry.Value * 7);
+        count++;
+        sum += entry.Value;
+    }
+
+    ASSERT_EQ(100, count);
+    ASSERT_EQ(99 * 100 / 2, sum);
+}
+
+TEST(TestHashmap, TestClearAndMove) {
+    HashMap<int, DynamicString> map{};
+    map.Insert(1, DynamicString{"one"});
+    map.Insert(2, DynamicString{"two"});
+
+    HashMap<int, DynamicString> moved{Move(map)};
+    ASSERT_EQ(0, map.Size());
+    ASSERT_EQ(2, moved.Size());
+    ASSERT_STREQ("two", moved[2].AsCString());
+
+    // A moved-from map is empty, but still usable
+    map.Insert(3, DynamicString{"three"});
+    ASSERT_STREQ("three", map[3].AsCString());
+
+    moved.Clear();
+    ASSERT_EQ(0, moved.Size());
+    ASSERT_EQ(nullptr, moved.GetOptional(1));
+    ASSERT_TRUE(moved.Begin() == moved.End());
+}
+
+TEST(TestHashmap, TestIteratorIncrement) {
+    HashMap<int, int> map{};
+    map.Insert(1, 10);
+    map.Insert(2, 20);
+
+    auto iterator = map.Begin();
+    auto previous = iterator++;
+    ASSERT_TRUE(previous == map.Begin());
+    ASSERT_TRUE(iterator != map.Begin());
+
+    auto& same = ++iterator;
+    ASSERT_EQ(&same, &iterator);
+    ASSERT_TRUE(iterator == map.End());
+}
+
+TEST(TestHashmap, TestIncrementalGrowth) {
+    HashMap<int, int> map{};
+
+    // Every key must stay reachable while the entries are being migrated to a bigger table
+    for (int i = 0; i < 300; i++) {
+        map.Insert(i, i);
+
+        int sum   = 0;
+        int count = 0;
+        for (const auto& entry : map) {
+            sum += entry.Value;
+            count++;
+        }
+
+        ASSERT_EQ(i + 1, count);
+        ASSERT_EQ(i * (i + 1) / 2, sum);
+
+        for (int j = 0; j <= i; j++) {
+            ASSERT_NE(nullptr, map.GetOptional(j));
+        }
+    }
+
+    // Removals and replacements in the middle of a migration
+    for (int i = 300; i < 400; i++) {
+        map.Insert(i, i);
+        ASSERT_TRUE(map.Remove(i - 300));
+        map.InsertOrReplace(i - 150, -1);
+        ASSERT_EQ(nullptr, map.InsertIfNotExist(i, 0));
+    }
+
+    ASSERT_EQ(300, map.Size());
+    for (int i = 0; i < 400; i++) {
+        if (i < 100) {
+            ASSERT_EQ(nullptr, map.GetOptional(i));
+        } else {
+            ASSERT_EQ(i >= 150 && i < 250 ? -1 : i, map[i]);
+        }
+    }
+}
@@ -30,10 +30,10 @@ TEST(TestIniFile, TestReader) {
     EXPECT_EQ(1, file.GetSection("person").GetKeyNames().Size()) << "Invalid keys count in the person section";
     EXPECT_EQ(2, file.GetSection("database").GetKeyNames().Size()) << "Invalid keys count in the database section";
 
-    EXPECT_STREQ("value", file.GetValue("", "key").AsCString());
-    EXPECT_STREQ("John Doe", file.GetValue("person", "name").AsCString());
-    EXPECT_STREQ("localhost", file.GetValue("database", "server").AsCString());
-    EXPECT_STREQ("3306", file.GetValue("database", "port").AsCString());
+    EXPECT_TRUE(file.GetValue("", "key") == "value");
+    EXPECT_TRUE(file.GetValue("person", "name") == "John Doe");
+    EXPECT_TRUE(file.GetValue("database", "server") == "localhost");
+    EXPECT_TRUE(file.GetValue("database", "port") == "3306");
 
     return;
 }
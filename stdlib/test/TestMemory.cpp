@@ -66,4 +66,97 @@ TEST(TestMemory, TestFillNonDivisible) {
     EXPECT_EQ(121, destination.Data[5]);
     EXPECT_EQ(4, destination.Data[6]);
     EXPECT_EQ(22, destination.Data[7]);
-}
\ No newline at end of file
+}
+namespace {
+    constexpr const size_t TEST_BUFFER_SIZE = 4200;
+
+    uint8_t TestByte(size_t index) {
+        return static_cast<uint8_t>(index * 7 + 3);
+    }
+}  // namespace
+
+TEST(TestMemory, TestCopyAllSizesAndOffsets) {
+    static uint8_t source[TEST_BUFFER_SIZE];
+    static uint8_t destination[TEST_BUFFER_SIZE];
+
+    for (size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+        source[i] = TestByte(i);
+    }
+
+    for (size_t size : {0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 64, 100, 255, 2047, 2048, 4096}) {
+        for (size_t offset = 0; offset < 8; offset++) {
+            Memory::Set(destination, 0xEE, TEST_BUFFER_SIZE);
+            Memory::Copy(destination + offset, source + 7 - offset, size);
+
+            for (size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+                const bool copied = i >= offset && i < offset + size;
+                ASSERT_EQ(copied ? TestByte(i - offset + 7 - offset) : 0xEE, destination[i]) << size << " " << offset;
+            }
+        }
+    }
+}
+
+TEST(TestMemory, TestSetAllSizes) {
+    static uint8_t destination[TEST_BUFFER_SIZE];
+
+    for (size_t size : {0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 64, 100, 255, 2047, 2048, 4096}) {
+        Memory::Set(destination, 0, TEST_BUFFER_SIZE);
+        Memory::Set(destination + 3, 0xAB, size);
+
+        for (size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+            ASSERT_EQ(i >= 3 && i < 3 + size ? 0xAB : 0, destination[i]) << size;
+        }
+    }
+}
+
+TEST(TestMemory, TestMoveOverlapping) {
+    static uint8_t buffer[TEST_BUFFER_SIZE];
+
+    for (size_t size : {5, 16, 17, 100, 2049}) {
+        for (size_t distance : {1, 3, 8, 13, 64}) {
+            // Destination above the source
+            for (size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+                buffer[i] = TestByte(i);
+            }
+
+            Memory::Move(buffer + distance, buffer, size);
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(TestByte(i), buffer[distance + i]) << size << " " << distance;
+            }
+
+            // Destination below the source
+            for (size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+                buffer[i] = TestByte(i);
+            }
+
+            Memory::Move(buffer, buffer + distance, size);
+            for (size_t i = 0; i < size; i++) {
+                ASSERT_EQ(TestByte(distance + i), buffer[i]) << size << " " << distance;
+            }
+        }
+    }
+}
+
+TEST(TestMemory, TestCopyNonTrivialType) {
+    struct Counted {
+        Counted() = default;
+
+        Counted& operator=(const Counted& other) {
+            Value       = other.Value;
+            Assignments = other.Assignments + 1;
+            return *this;
+        }
+
+        int Value       = 0;
+        int Assignments = 0;
+    };
+
+    Counted source[3];
+    Counted destination[3];
+    source[1].Value = 5;
+
+    Memory::Copy(destination, source, 3);
+
+    EXPECT_EQ(5, destination[1].Value);
+    EXPECT_EQ(1, destination[1].Assignments);
+}
@@ -0,0 +1,100 @@
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/ObjectCache.hpp>
+
+#include <gtest/gtest.h>
+#include "TrackableObject.hpp"
+
+using namespace FunnyOS::Stdlib;
+
+namespace {
+    struct TestSmallObject {
+        uint64_t First;
+        uint64_t Second;
+        uint64_t Third;
+    };
+
+    struct alignas(64) TestAlignedObject {
+        uint8_t Data[8];
+    };
+
+    struct TestBigObject {
+        uint8_t Data[SlabCache::SLAB_SIZE];
+    };
+}  // namespace
+
+TEST(TestObjectCache, TestSlabCacheAllocate) {
+    SlabCache cache{24, 8};
+    ASSERT_EQ(24, cache.GetObjectSize());
+
+    const size_t count = cache.GetObjectsPerSlab() * 3;
+    auto** objects     = new void*[count];
+
+    for (size_t i = 0; i < count; i++) {
+        objects[i] = cache.Allocate();
+        ASSERT_NE(nullptr, objects[i]);
+        Memory::SizedBuffer<uint8_t> buffer{static_cast<uint8_t*>(objects[i]), 24};
+        Memory::Set(buffer, static_cast<uint8_t>(i));
+    }
+    EXPECT_EQ(3, cache.GetSlabCount());
+
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(static_cast<uint8_t>(i), *static_cast<uint8_t*>(objects[i]));
+        cache.Free(objects[i]);
+    }
+
+    // One empty slab is kept
+    EXPECT_EQ(1, cache.GetSlabCount());
+
+    delete[] objects;
+}
+
+TEST(TestObjectCache, TestSlabCacheReusesFreedObject) {
+    SlabCache cache{16, 8};
+
+    void* first  = cache.Allocate();
+    void* second = cache.Allocate();
+    cache.Free(first);
+
+    void* third = cache.Allocate();
+    EXPECT_EQ(first, third);
+
+    cache.Free(second);
+    cache.Free(third);
+}
+
+TEST(TestObjectCache, TestObjectCacheAlignment) {
+    void* objects[100];
+
+    for (auto& memory : objects) {
+        memory = ObjectCache<TestAlignedObject>::Allocate();
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(memory) % 64);
+    }
+
+    for (void* memory : objects) {
+        ObjectCache<TestAlignedObject>::Free(memory);
+    }
+}
+
+TEST(TestObjectCache, TestObjectCacheSharedBySize) {
+    EXPECT_EQ(&ObjectCache<TestSmallObject>::GetSlabCache(), &ObjectCache<uint64_t[3]>::GetSlabCache());
+    EXPECT_NE(&ObjectCache<TestSmallObject>::GetSlabCache(), &ObjectCache<TestAlignedObject>::GetSlabCache());
+}
+
+TEST(TestObjectCache, TestObjectCacheNewDelete) {
+    TrackableObject::ResetAll();
+
+    TrackableObject* object = ObjectCache<TrackableObject>::New();
+    EXPECT_TRUE(object->IsValidObject());
+    EXPECT_EQ(1, TrackableObject::GetStandardConstructionCount());
+
+    ObjectCache<TrackableObject>::Delete(object);
+    EXPECT_EQ(1, TrackableObject::GetDestructionCount());
+}
+
+TEST(TestObjectCache, TestObjectCacheBigObject) {
+    EXPECT_FALSE(ObjectCache<TestBigObject>::USES_SLABS);
+
+    TestBigObject* object = ObjectCache<TestBigObject>::New();
+    ASSERT_NE(nullptr, object);
+    ObjectCache<TestBigObject>::Delete(object);
+}
@@ -52,6 +52,139 @@ TEST(TestString, TestCompare) {
     EXPECT_GT(CompareWithMax("This is a string", "This is a completely different string", 11), 0);
 }
 
+namespace {
+    /**
+     * Buffer with a test string at every offset, so the block functions see every alignment.
+     */
+    constexpr const size_t OFFSET_BUFFER_SIZE = 128;
+
+    int ReferenceCompare(const char* string1, const char* string2, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (string1[i] != string2[i] || string1[i] == 0) {
+                return static_cast<unsigned char>(string1[i]) - static_cast<unsigned char>(string2[i]);
+            }
+        }
+
+        return 0;
+    }
+
+    int Sign(int value) {
+        return value < 0 ? -1 : value > 0 ? 1 : 0;
+    }
+}  // namespace
+
+TEST(TestString, TestLengthAllOffsets) {
+    alignas(64) char buffer[OFFSET_BUFFER_SIZE];
+
+    for (size_t offset = 0; offset < 32; offset++) {
+        for (size_t length = 0; length < 70; length++) {
+            Memory::Set(buffer, 0x01, sizeof(buffer));
+            buffer[offset + length] = 0;
+
+            ASSERT_EQ(length, Length(buffer + offset)) << offset;
+        }
+    }
+}
+
+TEST(TestString, TestCompareAllOffsets) {
+    alignas(64) char buffer1[OFFSET_BUFFER_SIZE];
+    alignas(64) char buffer2[OFFSET_BUFFER_SIZE];
+
+    for (size_t offset1 = 0; offset1 < 17; offset1++) {
+        for (size_t offset2 = 0; offset2 < 17; offset2++) {
+            for (size_t difference = 0; difference < 40; difference += 3) {
+                Memory::Set(buffer1, 'a', sizeof(buffer1));
+                Memory::Set(buffer2, 'a', sizeof(buffer2));
+                buffer1[offset1 + 50]         = 0;
+                buffer2[offset2 + 50]         = 0;
+                buffer2[offset2 + difference] = 'b';
+
+                const char* string1 = buffer1 + offset1;
+                const char* string2 = buffer2 + offset2;
+                ASSERT_GT(0, Compare(string1, string2));
+                ASSERT_LT(0, Compare(string2, string1));
+                ASSERT_EQ(Sign(ReferenceCompare(string1, string2, difference)),
+                          Sign(CompareWithMax(string1, string2, difference)));
+                ASSERT_EQ(0, Compare(string1, string1));
+            }
+        }
+    }
+}
+
+TEST(TestString, TestCompareDifferentLengths) {
+    EXPECT_EQ(0, Compare("abcdefghijklmnopqrstuvwxyz", "abcdefghijklmnopqrstuvwxyz"));
+    EXPECT_GT(0, Compare("abcdefghijklmnopqrstuvwxy", "abcdefghijklmnopqrstuvwxyz"));
+    EXPECT_LT(0, Compare("abcdefghijklmnopqrstuvwxyz", "abcdefghijklmnopqrstuvwxy"));
+    EXPECT_EQ(0, CompareWithMax("abcdefghijklmnopqrstuvwxyz", "abcdefghijklmnopqrstuvwxy", 25));
+    EXPECT_EQ(0, CompareWithMax("abc", "abd", 0));
+}
+
+TEST(TestString, TestIndexOf) {
+    EXPECT_EQ(-1, IndexOf("", 'a'));
+    EXPECT_EQ(0, IndexOf("a", 'a'));
+    EXPECT_EQ(-1, IndexOf("abc", 0));
+    EXPECT_EQ(2, IndexOf("ccbbcc", 'b'));
+    EXPECT_EQ(30, IndexOf("------------------------------x--x", 'x'));
+    EXPECT_EQ(-1, IndexOf("------------------------------", 'x'));
+
+    alignas(64) char buffer[OFFSET_BUFFER_SIZE];
+    for (size_t offset = 0; offset < 17; offset++) {
+        for (size_t position = 0; position < 40; position++) {
+            Memory::Set(buffer, '-', sizeof(buffer));
+            buffer[offset + 40]       = 0;
+            buffer[offset + position] = 'x';
+            buffer[offset + 39]       = 'x';
+
+            ASSERT_EQ(position, IndexOf(buffer + offset, 'x'));
+            if (offset > 0) {
+                buffer[offset - 1] = 'y';
+                ASSERT_EQ(-1, IndexOf(buffer + offset, 'y'));
+            }
+        }
+    }
+}
+
+TEST(TestString, TestLastIndexOf) {
+    EXPECT_EQ(-1, LastIndexOf("", 'a'));
+    EXPECT_EQ(0, LastIndexOf("a", 'a'));
+    EXPECT_EQ(-1, LastIndexOf("abc", 0));
+    EXPECT_EQ(3, LastIndexOf("ccbbcc", 'b'));
+    EXPECT_EQ(33, LastIndexOf("x-----------------------------x--x", 'x'));
+
+    alignas(64) char buffer[OFFSET_BUFFER_SIZE];
+    for (size_t offset = 0; offset < 17; offset++) {
+        for (size_t position = 0; position < 40; position++) {
+            Memory::Set(buffer, 'x', sizeof(buffer));
+            Memory::Set(buffer + offset, '-', 40);
+            buffer[offset + 40]       = 0;
+            buffer[offset]            = 'x';
+            buffer[offset + position] = 'x';
+
+            ASSERT_EQ(position, LastIndexOf(buffer + offset, 'x'));
+        }
+    }
+}
+
+TEST(TestString, TestCount) {
+    EXPECT_EQ(0, Count("", " \t"));
+    EXPECT_EQ(0, Count("abc", ""));
+    EXPECT_EQ(3, Count("a b\tc d", " \t"));
+    EXPECT_EQ(6, Count("/usr/local/lib/x/y/z", "/"));
+
+    alignas(64) char buffer[OFFSET_BUFFER_SIZE];
+    for (size_t offset = 0; offset < 17; offset++) {
+        for (size_t length = 0; length < 50; length++) {
+            Memory::Set(buffer, '/', sizeof(buffer));
+            buffer[offset + length] = 0;
+            for (size_t i = 0; i < length; i += 2) {
+                buffer[offset + i] = 'a';
+            }
+
+            ASSERT_EQ(length / 2, Count(buffer + offset, "/"));
+        }
+    }
+}
+
 TEST(TestString, TextNextToken) {
     auto buf = AllocateCopy("Hello, this is, a test string");
 
@@ -0,0 +1,82 @@
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/DynamicString.hpp>
+#include <FunnyOS/Stdlib/HashMap.hpp>
+#include <FunnyOS/Stdlib/StringView.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace FunnyOS::Stdlib;
+
+TEST(TestStringView, TestConstruction) {
+    const StringView empty;
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_EQ(empty.Size(), 0);
+
+    const char* text = "Hello world";
+    const StringView view(text);
+    EXPECT_EQ(view.Data(), text);
+    EXPECT_EQ(view.Size(), 11);
+    EXPECT_EQ(view[4], 'o');
+    EXPECT_THROW((void)view[11], StringIndexOutOfBounds);
+
+    // A view of a DynamicString does not copy it
+    const DynamicString string("Hello world");
+    const StringView stringView = string;
+    EXPECT_EQ(stringView.Data(), string.AsCString());
+    EXPECT_TRUE(stringView == view);
+}
+
+TEST(TestStringView, TestAlgorithms) {
+    const StringView view(" \tkey = value\n");
+
+    EXPECT_EQ(view.IndexOf('='), 6);
+    EXPECT_EQ(view.LastIndexOf('e'), 12);
+    EXPECT_EQ(view.IndexOf('#'), StringView::NOT_FOUND);
+
+    const StringView trimmed = view.Trim();
+    EXPECT_TRUE(trimmed == "key = value");
+    EXPECT_TRUE(trimmed.StartsWith("key"));
+    EXPECT_TRUE(trimmed.EndsWith("value"));
+    EXPECT_FALSE(trimmed.EndsWith("key"));
+    EXPECT_TRUE(trimmed.Trim("kve") == "y = valu");
+
+    EXPECT_TRUE(trimmed.Substring(6) == "value");
+    EXPECT_TRUE(trimmed.Substring(0, 3) == "key");
+    EXPECT_TRUE(trimmed.Substring(6, 100) == "value");
+    EXPECT_TRUE(trimmed.Substring(11).IsEmpty());
+    EXPECT_THROW((void)trimmed.Substring(12), StringIndexOutOfBounds);
+
+    EXPECT_FALSE(trimmed == "key");
+    EXPECT_TRUE(trimmed != "key");
+}
+
+TEST(TestStringView, TestHashMatchesDynamicString) {
+    const DynamicString string("a string longer than the inline storage");
+
+    EXPECT_EQ(Hash<DynamicString>{}(string), Hash<StringView>{}(StringView{string}));
+    EXPECT_EQ(Hash<DynamicString>{}(DynamicString("")), Hash<StringView>{}(StringView{}));
+}
+
+TEST(TestStringView, TestHeterogeneousLookup) {
+    HashMap<DynamicString, int> map;
+    map.Insert(DynamicString("one"), 1);
+    map.Insert(DynamicString("a key longer than the inline storage"), 2);
+
+    // The lookups do not construct any DynamicString
+    const char buffer[] = "one two";
+    const StringView one(buffer, 3);
+
+    ASSERT_NE(map.GetOptional(one), nullptr);
+    EXPECT_EQ(*map.GetOptional(one), 1);
+    EXPECT_EQ(*map.GetOptional(StringView("a key longer than the inline storage")), 2);
+    EXPECT_EQ(map.GetOptional(StringView(buffer + 4, 3)), nullptr);
+    EXPECT_TRUE(map.ContainsKey(one));
+
+    const auto& constMap = map;
+    EXPECT_EQ(*constMap.GetOptional(one), 1);
+
+    EXPECT_TRUE(map.Remove(one));
+    EXPECT_FALSE(map.Remove(one));
+    EXPECT_FALSE(map.ContainsKey(one));
+    EXPECT_EQ(map.Size(), 1);
+}
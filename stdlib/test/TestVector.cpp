@@ -206,7 +206,10 @@ TEST(TestVector, CheckRemoveAllocations) {
         EXPECT_EQ(2, vector.Size());
         vector.Remove(0);
         EXPECT_EQ(1, vector.Size());
-        EXPECT_EQ(TrackableObject::GetDestructionCount(), 3);
+
+        // The removed object, and the second one after it was moved to the front
+        EXPECT_EQ(TrackableObject::GetMoveConstructionCount(), 1);
+        EXPECT_EQ(TrackableObject::GetDestructionCount(), 4);
 
         // Force reallocation
         vector.ShrinkToSize();
@@ -267,3 +270,138 @@ TEST(TestVector, CheckInsertRange) {
         // OK
     }
 }
+
+TEST(TestVector, CheckRelocationAllocations) {
+    static_assert(!IsTriviallyRelocatable<TrackableObject>);
+
+    {
+        TrackableObject::ResetAll();
+        Vector<TrackableObject> vector(1);
+
+        // Growing, shifting and removing move every element with its move constructor
+        for (int i = 0; i < 10; i++) {
+            vector.AppendInPlace();
+        }
+        vector.InsertInPlace(0);
+        vector.RemoveRange(2, 5);
+        vector.Remove(0);
+        vector.ShrinkToSize();
+
+        EXPECT_EQ(6, vector.Size());
+        EXPECT_EQ(0, TrackableObject::GetCopyConstructionCount());
+        EXPECT_LT(0, TrackableObject::GetMoveConstructionCount());
+
+        for (auto& ref : vector) {
+            EXPECT_TRUE(ref.IsValidObject()) << "Object is invalid";
+        }
+    }
+
+    ASSERT_EQ(TrackableObject::GetTotalConstructionCount(), TrackableObject::GetDestructionCount())
+        << "Construction count != destruction count";
+}
+
+TEST(TestVector, CheckTriviallyRelocatable) {
+    static_assert(IsTriviallyRelocatable<uint8_t>);
+    static_assert(IsTriviallyRelocatable<Vector<TrackableObject>>);
+
+    // Vectors of vectors are relocated in bulk, without touching the inner elements
+    Vector<Vector<int>> vectors;
+    for (int i = 0; i < 100; i++) {
+        vectors.Insert(0, Vector<int>{i, i + 1});
+    }
+    vectors.RemoveRange(10, 89);
+
+    ASSERT_EQ(20, vectors.Size());
+    for (size_t i = 0; i < vectors.Size(); i++) {
+        const int expected = i < 10 ? 99 - static_cast<int>(i) : 19 - static_cast<int>(i);
+        EXPECT_EQ(expected, vectors[i][0]);
+        EXPECT_EQ(expected + 1, vectors[i][1]);
+    }
+
+    uint8_t bytes[1000];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    Vector<uint8_t> data;
+    data.Insert(0, bytes + 500, 500);
+    data.Insert(0, static_cast<const uint8_t*>(bytes), 500);
+
+    ASSERT_EQ(1000, data.Size());
+    for (size_t i = 0; i < data.Size(); i++) {
+        ASSERT_EQ(static_cast<uint8_t>(i), data[i]);
+    }
+}
+
+TEST(TestVector, CheckInlineVector) {
+    InlineVector<int, 4> vector = {1, 2, 3};
+    const int* inlineData       = vector.Begin();
+
+    // The storage is inside the vector itself
+    EXPECT_EQ(4, vector.Capacity());
+    EXPECT_GE(reinterpret_cast<const uint8_t*>(inlineData), reinterpret_cast<const uint8_t*>(&vector));
+    EXPECT_LT(reinterpret_cast<const uint8_t*>(inlineData), reinterpret_cast<const uint8_t*>(&vector + 1));
+
+    vector.Append(4);
+    EXPECT_EQ(inlineData, vector.Begin());
+
+    // Spills to the heap and comes back when shrunk
+    vector.Append(5);
+    EXPECT_NE(inlineData, vector.Begin());
+    EXPECT_LT(4, vector.Capacity());
+
+    vector.RemoveRange(0, 1);
+    vector.ShrinkToSize();
+    EXPECT_EQ(inlineData, vector.Begin());
+    ASSERT_EQ(3, vector.Size());
+    EXPECT_EQ(3, vector[0]);
+    EXPECT_EQ(4, vector[1]);
+    EXPECT_EQ(5, vector[2]);
+
+    // Moving copies inline elements and steals the heap
+    InlineVector<int, 4> moved = Move(vector);
+    EXPECT_EQ(0, vector.Size());
+    ASSERT_EQ(3, moved.Size());
+    EXPECT_EQ(5, moved[2]);
+
+    for (int i = 0; i < 10; i++) {
+        moved.Append(i);
+    }
+    const int* heapData = moved.Begin();
+
+    vector = Move(moved);
+    EXPECT_EQ(heapData, vector.Begin());
+    EXPECT_EQ(13, vector.Size());
+    EXPECT_EQ(0, moved.Size());
+    EXPECT_EQ(4, moved.Capacity());
+}
+
+TEST(TestVector, CheckInlineVectorAllocations) {
+    {
+        TrackableObject::ResetAll();
+        InlineVector<TrackableObject, 2> vector;
+
+        for (int i = 0; i < 5; i++) {
+            vector.AppendInPlace();
+        }
+        vector.RemoveRange(0, 2);
+        vector.ShrinkToSize();
+
+        InlineVector<TrackableObject, 2> moved = Move(vector);
+        InlineVector<TrackableObject, 2> copied(moved);
+
+        EXPECT_EQ(0, vector.Size());
+        EXPECT_EQ(2, moved.Size());
+        EXPECT_EQ(2, copied.Size());
+
+        for (auto& ref : moved) {
+            EXPECT_TRUE(ref.IsValidObject()) << "Object is invalid";
+        }
+        for (auto& ref : copied) {
+            EXPECT_TRUE(ref.IsValidObject()) << "Object is invalid";
+        }
+    }
+
+    ASSERT_EQ(TrackableObject::GetTotalConstructionCount(), TrackableObject::GetDestructionCount())
+        << "Construction count != destruction count";
+}
@@ -0,0 +1,162 @@
+/*
+ * Measures BasicDynamicString, which keeps short strings inline, against the Vector-backed string it replaced, on
+ * the workloads of TestDynamicString, and measures IniFileReader::Read, whose keys and values are short strings.
+ *
+ * Usage:
+ *   FunnyOS_Stdlib_DynamicStringBenchmark [iterations]
+ */
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/DynamicString.hpp>
+#include <FunnyOS/Stdlib/IniFile.hpp>
+#include <FunnyOS/Stdlib/Vector.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace FunnyOS::Stdlib;
+
+namespace {
+    /**
+     * Lengths of the benchmarked strings, an INI key, a full inline string, a path and a log line.
+     */
+    constexpr const size_t STRING_LENGTHS[] = {8, 23, 40, 100};
+
+    /**
+     * Amount of keys in the generated INI file.
+     */
+    constexpr const size_t INI_KEYS = 200;
+
+    namespace Previous {
+        /**
+         * The previous implementation, a Vector of the characters and the terminator.
+         */
+        class VectorString {
+           public:
+            VectorString() = default;
+
+            VectorString(const char* data) {
+                const size_t length = String::Length(data);
+                m_data.EnsureCapacity(length + 1);
+                m_data.Insert(0, data, length);
+                m_data.Append(0);
+            }
+
+            void Append(char character) {
+                if (m_data.Size() == 0) {
+                    m_data.Append(0);
+                }
+
+                m_data.Insert(m_data.Size() - 1, character);
+            }
+
+            size_t Size() const {
+                return m_data.Size() == 0 ? 0 : m_data.Size() - 1;
+            }
+
+           private:
+            Vector<char> m_data;
+        };
+    }  // namespace Previous
+
+    struct Workload {
+        const char* Name;
+        std::function<size_t(const char*, size_t)> Previous;
+        std::function<size_t(const char*, size_t)> Current;
+    };
+
+    template <typename S>
+    size_t Construct(const char* text, size_t) {
+        S string{text};
+        return string.Size();
+    }
+
+    template <typename S>
+    size_t AppendCharacters(const char* text, size_t length) {
+        S string;
+        for (size_t i = 0; i < length; i++) {
+            string.Append(text[i]);
+        }
+
+        return string.Size();
+    }
+
+    template <typename S>
+    size_t CopyToVector(const char* text, size_t) {
+        const S string{text};
+        Vector<S> vector(8);
+
+        for (size_t i = 0; i < 8; i++) {
+            vector.Append(string);
+        }
+
+        return vector.Size();
+    }
+
+    std::vector<Workload> GetWorkloads() {
+        return {
+            {"construct", Construct<Previous::VectorString>, Construct<DynamicString>},
+            {"append", AppendCharacters<Previous::VectorString>, AppendCharacters<DynamicString>},
+            {"copy x8", CopyToVector<Previous::VectorString>, CopyToVector<DynamicString>},
+        };
+    }
+
+    double Measure(size_t iterations, const std::function<size_t()>& function) {
+        volatile size_t sink = 0;
+        const auto start     = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < iterations; i++) {
+            sink = function();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        (void)sink;
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    std::string MakeIniFile() {
+        std::string file;
+
+        for (size_t i = 0; i < INI_KEYS; i++) {
+            if (i % 20 == 0) {
+                file += "[section" + std::to_string(i / 20) + "]\n";
+            }
+
+            file += "key" + std::to_string(i) + " = value " + std::to_string(i * 7) + "\n";
+        }
+
+        return file;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t iterations = argc > 1 ? strtoull(argv[1], nullptr, 10) : 200000;
+
+    printf("%-12s %8s %12s %12s\n", "workload", "length", "vector ns", "inline ns");
+
+    for (const Workload& workload : GetWorkloads()) {
+        for (const size_t length : STRING_LENGTHS) {
+            const std::string text(length, 'a');
+
+            const double previous = Measure(iterations, [&] { return workload.Previous(text.c_str(), length); });
+            const double current  = Measure(iterations, [&] { return workload.Current(text.c_str(), length); });
+
+            printf("%-12s %8zu %12.2f %12.2f\n", workload.Name, length, previous, current);
+        }
+    }
+
+    const std::string file = MakeIniFile();
+    const double readTime  = Measure(iterations / 100 + 1, [&] {
+        IniFileReader reader{MakeOwnerBase<IReadInterface, FromMemoryReadInterface>(
+            reinterpret_cast<const uint8_t*>(file.data()), file.size())};
+
+        return reader.Read().GetSectionNames().Size();
+    });
+
+    printf("\nIniFileReader::Read, %zu keys: %.2f us\n", INI_KEYS, readTime / 1000);
+    return 0;
+}
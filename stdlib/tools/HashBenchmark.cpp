@@ -0,0 +1,182 @@
+/*
+ * Measures the speed and the bucket distribution of the Stdlib::Hash functions against the hashes they replaced,
+ * the identity for integers and the byte-at-a-time 31 * h for strings.
+ *
+ * The distribution is measured the way HashMap uses the hashes, by masking them with a power-of-two table size.
+ * A perfectly uniform hash has a collision ratio of about 1.0, higher values mean longer probe sequences.
+ *
+ * Usage:
+ *   FunnyOS_Stdlib_HashBenchmark [iterations]
+ */
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/Hash.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+using FunnyOS::Stdlib::hash_t;
+
+namespace {
+    /**
+     * Lengths of the benchmarked strings, from INI keys to whole file names and lines.
+     */
+    constexpr const size_t STRING_LENGTHS[] = {4, 8, 16, 32, 64, 256, 1024};
+
+    /**
+     * Amount of keys in every distribution test and the amount of buckets they are masked into.
+     */
+    constexpr const size_t KEY_COUNT    = 1 << 16;
+    constexpr const size_t BUCKET_COUNT = 1 << 16;
+
+    namespace Previous {
+        hash_t Integer(uint64_t value) {
+            return static_cast<hash_t>(value);
+        }
+
+        hash_t String(const char* string, size_t length) {
+            hash_t hash = 0;
+
+            for (size_t i = 0; i < length; i++) {
+                hash = 31 * hash + string[i];
+            }
+
+            return hash;
+        }
+    }  // namespace Previous
+
+    struct IntegerHash {
+        const char* Name;
+        std::function<hash_t(uint64_t)> Run;
+    };
+
+    struct StringHash {
+        const char* Name;
+        std::function<hash_t(const char*, size_t)> Run;
+    };
+
+    std::vector<IntegerHash> GetIntegerHashes() {
+        return {{"identity", Previous::Integer}, {"mix", FunnyOS::Stdlib::MixInteger}};
+    }
+
+    std::vector<StringHash> GetStringHashes() {
+        return {{"31*h", Previous::String},
+                {"bytes", [](const char* s, size_t length) { return FunnyOS::Stdlib::HashBytes(s, length); }}};
+    }
+
+    /**
+     * Sum of squared bucket loads relative to that of a uniformly random hash.
+     */
+    double CollisionRatio(const std::vector<hash_t>& hashes) {
+        std::vector<size_t> buckets(BUCKET_COUNT, 0);
+        for (const hash_t hash : hashes) {
+            buckets[hash & (BUCKET_COUNT - 1)]++;
+        }
+
+        double sumOfSquares = 0;
+        for (const size_t load : buckets) {
+            sumOfSquares += static_cast<double>(load) * load;
+        }
+
+        const double load     = static_cast<double>(hashes.size()) / BUCKET_COUNT;
+        const double expected = hashes.size() * (load + 1.0 - 1.0 / BUCKET_COUNT);
+        return sumOfSquares / expected;
+    }
+
+    void MeasureIntegerDistribution() {
+        // Sequential keys, page addresses and keys that differ only in their high bits
+        const struct {
+            const char* Name;
+            uint64_t Stride;
+        } keySets[] = {{"sequential", 1}, {"pages", 4096}, {"high bits", 1ULL << 40}};
+
+        for (const auto& keySet : keySets) {
+            for (const IntegerHash& hash : GetIntegerHashes()) {
+                std::vector<hash_t> hashes;
+                for (uint64_t i = 0; i < KEY_COUNT; i++) {
+                    hashes.push_back(hash.Run(0xFFFF800000000000 + i * keySet.Stride));
+                }
+
+                printf("%-12s %-20s %10s %12.3f\n", "integer", keySet.Name, hash.Name, CollisionRatio(hashes));
+            }
+        }
+    }
+
+    void MeasureStringDistribution() {
+        const char* formats[] = {"key%zu", "section%zu.name", "/bin/program%zu.elf"};
+
+        for (const char* format : formats) {
+            std::vector<std::string> keys;
+            for (size_t i = 0; i < KEY_COUNT; i++) {
+                char key[64];
+                snprintf(key, sizeof(key), format, i);
+                keys.emplace_back(key);
+            }
+
+            for (const StringHash& hash : GetStringHashes()) {
+                std::vector<hash_t> hashes;
+                for (const std::string& key : keys) {
+                    hashes.push_back(hash.Run(key.data(), key.size()));
+                }
+
+                printf("%-12s %-20s %10s %12.3f\n", "string", format, hash.Name, CollisionRatio(hashes));
+            }
+        }
+    }
+
+    void MeasureIntegerSpeed(size_t iterations) {
+        for (const IntegerHash& hash : GetIntegerHashes()) {
+            volatile hash_t sink = 0;
+            const auto start     = std::chrono::steady_clock::now();
+
+            for (size_t i = 0; i < iterations; i++) {
+                sink = hash.Run(i);
+            }
+
+            const auto end  = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+            printf("%-12s %8d %-10s %12.2f\n", "integer", 8, hash.Name, ns);
+            (void)sink;
+        }
+    }
+
+    void MeasureStringSpeed(size_t iterations) {
+        for (const size_t length : STRING_LENGTHS) {
+            const std::string string(length + 8, 'a');
+
+            for (const StringHash& hash : GetStringHashes()) {
+                volatile hash_t sink = 0;
+                const auto start     = std::chrono::steady_clock::now();
+
+                for (size_t i = 0; i < iterations; i++) {
+                    // A different offset every time, so the hash can not be hoisted out of the loop
+                    sink = hash.Run(string.data() + (i & 7), length);
+                }
+
+                const auto end  = std::chrono::steady_clock::now();
+                const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+                printf("%-12s %8zu %-10s %12.2f\n", "string", length, hash.Name, ns);
+                (void)sink;
+            }
+        }
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t iterations = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+
+    printf("%-12s %-20s %10s %12s\n", "keys", "set", "hash", "collisions");
+    MeasureIntegerDistribution();
+    MeasureStringDistribution();
+
+    printf("\n%-12s %8s %-10s %12s\n", "keys", "length", "hash", "ns/call");
+    MeasureIntegerSpeed(iterations);
+    MeasureStringSpeed(iterations);
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * Measures the block-at-a-time string functions of Stdlib::String against the character-at-a-time versions they
+ * replaced and against the host C library.
+ *
+ * Usage:
+ *   FunnyOS_Stdlib_StringBenchmark [iterations]
+ */
+#include "Common.hpp"
+#include <FunnyOS/Stdlib/String.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace String = FunnyOS::Stdlib::String;
+
+namespace {
+    /**
+     * Lengths of the benchmarked strings, from INI keys to long log lines.
+     */
+    constexpr const size_t STRING_LENGTHS[] = {7, 31, 100, 1000};
+
+    /**
+     * Amount of differently aligned copies of every string, so every alignment of the head is measured.
+     */
+    constexpr const size_t ALIGNMENTS = 16;
+
+    namespace CharacterAtATime {
+        size_t Length(const char* string) {
+            size_t length = 0;
+            while (*(string + length) != 0) {
+                length++;
+            }
+
+            return length;
+        }
+
+        int Compare(const char* string1, const char* string2) {
+            for (size_t i = 0;; i++) {
+                const char c1 = string1[i];
+                const char c2 = string2[i];
+
+                if (c1 == 0 || c2 == 0 || c1 != c2) {
+                    return c1 - c2;
+                }
+            }
+        }
+
+        int IndexOf(const char* string, char character) {
+            for (int i = 0; string[i] != 0; i++) {
+                if (string[i] == character) {
+                    return i;
+                }
+            }
+
+            return -1;
+        }
+
+        int LastIndexOf(const char* string, char character) {
+            for (int i = static_cast<int>(Length(string)) - 1; i >= 0; i--) {
+                if (string[i] == character) {
+                    return i;
+                }
+            }
+
+            return -1;
+        }
+
+        int Count(const char* string, const char* pattern) {
+            int count = 0;
+
+            for (; *string != 0; string++) {
+                for (const char* character = pattern; *character != 0; character++) {
+                    if (*string == *character) {
+                        count++;
+                        break;
+                    }
+                }
+            }
+
+            return count;
+        }
+    }  // namespace CharacterAtATime
+
+    namespace HostLibrary {
+        int IndexOf(const char* string, char character) {
+            const char* position = strchr(string, character);
+            return position == nullptr ? -1 : static_cast<int>(position - string);
+        }
+
+        int LastIndexOf(const char* string, char character) {
+            const char* position = strrchr(string, character);
+            return position == nullptr ? -1 : static_cast<int>(position - string);
+        }
+
+        int Count(const char* string, const char* pattern) {
+            int count = 0;
+
+            for (string += strcspn(string, pattern); *string != 0; string += strcspn(string, pattern)) {
+                count++;
+                string++;
+            }
+
+            return count;
+        }
+    }  // namespace HostLibrary
+
+    struct Implementation {
+        const char* Name;
+        std::function<size_t(const char*, const char*)> Run;
+    };
+
+    struct Operation {
+        const char* Name;
+        std::vector<Implementation> Implementations;
+    };
+
+    std::vector<Operation> GetOperations() {
+        // Every string is a run of 'a' with a single '/' in the middle, the second argument is an equal string
+        return {
+            {"Length",
+             {{"character", [](const char* s, const char*) { return CharacterAtATime::Length(s); }},
+              {"block", [](const char* s, const char*) { return String::Length(s); }},
+              {"host", [](const char* s, const char*) { return strlen(s); }}}},
+            {"Compare",
+             {{"character", [](const char* s, const char* t) { return size_t(CharacterAtATime::Compare(s, t)); }},
+              {"block", [](const char* s, const char* t) { return size_t(String::Compare(s, t)); }},
+              {"host", [](const char* s, const char* t) { return size_t(strcmp(s, t)); }}}},
+            {"IndexOf",
+             {{"character", [](const char* s, const char*) { return size_t(CharacterAtATime::IndexOf(s, '/')); }},
+              {"block", [](const char* s, const char*) { return size_t(String::IndexOf(s, '/')); }},
+              {"host", [](const char* s, const char*) { return size_t(HostLibrary::IndexOf(s, '/')); }}}},
+            {"LastIndexOf",
+             {{"character", [](const char* s, const char*) { return size_t(CharacterAtATime::LastIndexOf(s, '/')); }},
+              {"block", [](const char* s, const char*) { return size_t(String::LastIndexOf(s, '/')); }},
+              {"host", [](const char* s, const char*) { return size_t(HostLibrary::LastIndexOf(s, '/')); }}}},
+            {"Count",
+             {{"character", [](const char* s, const char*) { return size_t(CharacterAtATime::Count(s, " /")); }},
+              {"block", [](const char* s, const char*) { return size_t(String::Count(s, " /")); }},
+              {"host", [](const char* s, const char*) { return size_t(HostLibrary::Count(s, " /")); }}}},
+        };
+    }
+
+    std::vector<char> MakeStrings(size_t length) {
+        // ALIGNMENTS copies, each starting one byte later in its own slot
+        const size_t slotSize = length + ALIGNMENTS + 1;
+        std::vector<char> strings(slotSize * ALIGNMENTS, 0);
+
+        for (size_t alignment = 0; alignment < ALIGNMENTS; alignment++) {
+            char* string = strings.data() + slotSize * alignment + alignment;
+            memset(string, 'a', length);
+            string[length / 2] = '/';
+        }
+
+        return strings;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const size_t iterations = argc > 1 ? strtoull(argv[1], nullptr, 10) : 200000;
+
+    printf("%-12s %8s %-10s %12s %10s\n", "operation", "length", "version", "ns/call", "result");
+
+    for (const Operation& operation : GetOperations()) {
+        for (const size_t length : STRING_LENGTHS) {
+            const std::vector<char> strings1 = MakeStrings(length);
+            const std::vector<char> strings2 = MakeStrings(length);
+            const size_t slotSize            = length + ALIGNMENTS + 1;
+
+            for (const Implementation& implementation : operation.Implementations) {
+                volatile size_t sink = 0;
+                const auto start     = std::chrono::steady_clock::now();
+
+                for (size_t i = 0; i < iterations; i++) {
+                    const size_t alignment = i % ALIGNMENTS;
+                    const char* string1    = strings1.data() + slotSize * alignment + alignment;
+                    const char* string2    = strings2.data() + slotSize * (ALIGNMENTS - 1 - alignment) +
+                                          (ALIGNMENTS - 1 - alignment);
+                    sink = implementation.Run(string1, string2);
+                }
+
+                const auto end  = std::chrono::steady_clock::now();
+                const double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+                printf("%-12s %8zu %-10s %12.2f %10zd\n", operation.Name, length, implementation.Name, ns,
+                       static_cast<ssize_t>(sink));
+            }
+        }
+    }
+
+    return 0;
+}